@@ -25,7 +25,9 @@ HEADERS +=  src/baseobjectview.h \
             src/schemaview.h \
             src/roundedrectitem.h \
             src/styledtextboxview.h \
-    src/beziercurveitem.h
+    src/beziercurveitem.h \
+    src/levelofdetaileffect.h \
+    src/relationshiprouter.h
 
 SOURCES +=  src/baseobjectview.cpp \
 	    src/textboxview.cpp \
@@ -39,7 +41,9 @@ SOURCES +=  src/baseobjectview.cpp \
 	    src/schemaview.cpp \
             src/roundedrectitem.cpp \
             src/styledtextboxview.cpp \
-    src/beziercurveitem.cpp
+    src/beziercurveitem.cpp \
+    src/levelofdetaileffect.cpp \
+    src/relationshiprouter.cpp
 
 unix|windows: LIBS += -L$$OUT_PWD/../libpgmodeler/ -lpgmodeler \
                     -L$$OUT_PWD/../libparsers/ -lparsers \
@@ -19,6 +19,7 @@
 #include "baseobjectview.h"
 #include "textboxview.h"
 #include "roundedrectitem.h"
+#include "objectsscene.h"
 
 map<QString, QTextCharFormat> BaseObjectView::font_config;
 map<QString, vector<QColor>> BaseObjectView::color_config;
@@ -408,6 +409,8 @@ QVariant BaseObjectView::itemChange(GraphicsItemChange change, const QVariant &v
 			graph_obj->setPosition(this->scenePos());
 			this->configurePositionInfo(this->pos());
 		}
+
+		notifyAreaChange();
 	}
 	else if(change == ItemSelectedHasChanged && obj_selection)
 	{
@@ -417,12 +420,34 @@ QVariant BaseObjectView::itemChange(GraphicsItemChange change, const QVariant &v
 		obj_selection->setVisible(value.toBool());
 
 		this->configurePositionInfo(this->pos());
+		notifyAreaChange();
 		emit s_objectSelected(dynamic_cast<BaseGraphicObject *>(this->getSourceObject()), value.toBool());
 	}
 
 	return(value);
 }
 
+void BaseObjectView::notifyAreaChange(void)
+{
+	ObjectsScene *obj_scene=dynamic_cast<ObjectsScene *>(this->scene());
+
+	if(!obj_scene)
+	{
+		last_scene_area=QRectF();
+		return;
+	}
+
+	if(this->parentItem())
+		return;
+
+	if(last_scene_area.isValid())
+		obj_scene->addDirtyArea(last_scene_area);
+
+	//The children are considered since some of them (e.g. relationship lines) are placed outside the bounding rect
+	last_scene_area=this->mapRectToScene(this->boundingRect() | this->childrenBoundingRect());
+	obj_scene->addDirtyArea(last_scene_area);
+}
+
 void BaseObjectView::setSelectionOrder(bool selected)
 {
 	if(this->sel_order==0 && selected)
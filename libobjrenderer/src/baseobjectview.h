@@ -62,6 +62,9 @@ class BaseObjectView: public QObject, public QGraphicsItemGroup {
 		//! \brief Stores the objects bounding rect
 		QRectF bounding_rect;
 
+		//! \brief Stores the area (in scene coordinates) occupied by the object when notifyAreaChange() was last called
+		QRectF last_scene_area;
+
 		//! \brief Graphical object that represents the object selection
 		QGraphicsItem *obj_selection;
 
@@ -183,6 +186,11 @@ class BaseObjectView: public QObject, public QGraphicsItemGroup {
 		//! \brief Returns the current factor between the default font size and the current defined one
 		static double getFontFactor(void);
 
+		/*! \brief Informs the objects scene that the area occupied by the object may have changed. The previously
+		occupied area and the current one are marked as dirty in the scene (see ObjectsScene::addDirtyArea()).
+		Only top level objects notify their areas since the children are contained in their parents' areas */
+		void notifyAreaChange(void);
+
 	protected slots:
 		//! \brief Make the basic object operations
 		void __configureObject(void);
@@ -38,20 +38,25 @@ BaseTableView::BaseTableView(BaseTable *base_tab) : BaseObjectView(base_tab)
 	ext_attribs_toggler->setRoundedCorners(RoundedRectItem::BOTTOMLEFT_CORNER | RoundedRectItem::BOTTOMRIGHT_CORNER);
 	ext_attribs_toggler->setZValue(-1);
 
+	//Columns, extended attributes and tag are not drawn when the table is too small to have them readable
 	ext_attribs=new QGraphicsItemGroup;
 	ext_attribs->setZValue(1);
+	ext_attribs->setGraphicsEffect(new LevelOfDetailEffect);
 
 	ext_attribs_tog_arrow=new QGraphicsPolygonItem;
 	ext_attribs_tog_arrow->setZValue(2);
 
 	columns=new QGraphicsItemGroup;
 	columns->setZValue(1);
+	columns->setGraphicsEffect(new LevelOfDetailEffect);
 
 	tag_name=new QGraphicsSimpleTextItem;
 	tag_name->setZValue(3);
+	tag_name->setGraphicsEffect(new LevelOfDetailEffect);
 
 	tag_body=new QGraphicsPolygonItem;
 	tag_body->setZValue(2);
+	tag_body->setGraphicsEffect(new LevelOfDetailEffect);
 
 	obj_shadow=new RoundedRectItem;
 	obj_shadow->setZValue(-1);
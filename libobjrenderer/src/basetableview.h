@@ -28,6 +28,7 @@
 #include "baseobjectview.h"
 #include "basetable.h"
 #include "tabletitleview.h"
+#include "levelofdetaileffect.h"
 #include "tableobjectview.h"
 #include "roundedrectitem.h"
 
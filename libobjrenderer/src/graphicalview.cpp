@@ -24,6 +24,7 @@ GraphicalView::GraphicalView(View *view) : BaseTableView(view)
 
 	columns=new QGraphicsItemGroup;
 	columns->setZValue(1);
+	columns->setGraphicsEffect(new LevelOfDetailEffect);
 	this->addToGroup(columns);
 	configurePlaceholder();
 	this->configureObject();
@@ -227,6 +228,7 @@ void GraphicalView::configureObject(void)
 	BaseObjectView::configureObjectSelection();
 	configureTag();
 	configureSQLDisabledInfo();
+	notifyAreaChange();
 	requestRelationshipsUpdate();
 }
 
@@ -0,0 +1,33 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "levelofdetaileffect.h"
+#include <QStyleOptionGraphicsItem>
+#include <QPainter>
+
+LevelOfDetailEffect::LevelOfDetailEffect(double min_detail, QObject *parent) : QGraphicsEffect(parent)
+{
+	this->min_detail=min_detail;
+}
+
+void LevelOfDetailEffect::draw(QPainter *painter)
+{
+	if(QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform()) >= min_detail)
+		drawSource(painter);
+}
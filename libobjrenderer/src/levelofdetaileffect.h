@@ -0,0 +1,51 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libobjrenderer
+\class LevelOfDetailEffect
+\brief Implements a graphics effect that skips the drawing of the item (and its children) when the level of detail
+of the painting (e.g. the viewport zoom) is below a minimum. It's used to avoid painting texts and small decorations
+that are unreadable when the model is zoomed out. Since the level of detail is determined from the painter's transform
+each render (viewport, magnifier, exported image) decides independently what is drawn.
+*/
+
+#ifndef LEVEL_OF_DETAIL_EFFECT_H
+#define LEVEL_OF_DETAIL_EFFECT_H
+
+#include <QGraphicsEffect>
+
+class LevelOfDetailEffect: public QGraphicsEffect {
+	private:
+		Q_OBJECT
+
+		//! \brief Minimum level of detail in which the source item is drawn
+		double min_detail;
+
+	protected:
+		void draw(QPainter *painter);
+
+	public:
+		//! \brief Default level of detail (scale factor) below which texts and decorations aren't drawn
+		static constexpr double MIN_DETAIL_LEVEL=0.40f;
+
+		LevelOfDetailEffect(double min_detail=MIN_DETAIL_LEVEL, QObject *parent=nullptr);
+};
+
+#endif
@@ -410,6 +410,60 @@ void ObjectsScene::emitExtAttributesToggled(void)
 	emit s_extAttributesToggled();
 }
 
+void ObjectsScene::updateRoutingObstacle(void)
+{
+	BaseTableView *tab=dynamic_cast<BaseTableView *>(sender());
+
+	if(tab)
+	{
+		for(auto &rel : rel_router.updateObstacle(tab, QRectF(tab->pos(), tab->boundingRect().size())))
+			rel->requestLineUpdate();
+	}
+}
+
+void ObjectsScene::addDirtyArea(const QRectF &area)
+{
+	QRectF rect=area;
+	bool merged=false;
+
+	if(!rect.isValid())
+		return;
+
+	//The areas are notified only when the control returns to the event loop
+	if(dirty_areas.isEmpty())
+		QTimer::singleShot(0, this, SLOT(emitDirtyAreas(void)));
+
+	/* The area is merged with the ones it overlaps. Since the merged area can
+	overlap other areas the procedure is repeated until no overlap is found */
+	do
+	{
+		merged=false;
+
+		for(int i=0; i < dirty_areas.size() && !merged; i++)
+		{
+			if(dirty_areas[i].intersects(rect))
+			{
+				rect=rect.united(dirty_areas[i]);
+				dirty_areas.removeAt(i);
+				merged=true;
+			}
+		}
+	}
+	while(merged);
+
+	dirty_areas.push_back(rect);
+}
+
+void ObjectsScene::emitDirtyAreas(void)
+{
+	QList<QRectF> areas;
+
+	areas.swap(dirty_areas);
+
+	if(!areas.isEmpty())
+		emit s_objectsAreasChanged(areas);
+}
+
 void ObjectsScene::emitChildObjectSelection(TableObject *child_obj)
 {
 	/* Treats the TableView::s_childObjectSelect() only when there is no
@@ -441,6 +495,12 @@ void ObjectsScene::addItem(QGraphicsItem *item)
 							this, SLOT(emitChildObjectSelection(TableObject*)));
 			connect(tab, SIGNAL(s_extAttributesToggled()),
 							this, SLOT(emitExtAttributesToggled()));
+
+			/* The table's area is kept updated in the relationships' router. These connections are made before the
+			relationships connect to the table so the router is updated before the lines are configured */
+			connect(tab, SIGNAL(s_objectMoved()), this, SLOT(updateRoutingObstacle()));
+			connect(tab, SIGNAL(s_relUpdateRequest()), this, SLOT(updateRoutingObstacle()));
+			connect(tab, SIGNAL(s_objectDimensionChanged()), this, SLOT(updateRoutingObstacle()));
 		}
 
 		if(obj)
@@ -450,6 +510,18 @@ void ObjectsScene::addItem(QGraphicsItem *item)
 		}
 
 		QGraphicsScene::addItem(item);
+
+		if(obj)
+			obj->notifyAreaChange();
+
+		if(tab)
+		{
+			for(auto &rel_view : rel_router.updateObstacle(tab, QRectF(tab->pos(), tab->boundingRect().size())))
+				rel_view->requestLineUpdate();
+		}
+		//The relationship's route can only be computed when it's in the scene
+		else if(rel && RelationshipView::getLineConnectinMode()==RelationshipView::CONNECT_ROUTED_LINES)
+			rel->configureLine();
 	}
 }
 
@@ -459,9 +531,22 @@ void ObjectsScene::removeItem(QGraphicsItem *item)
 	{
 		BaseObjectView *object=dynamic_cast<BaseObjectView *>(item);
 		RelationshipView *rel=dynamic_cast<RelationshipView *>(item);
+		BaseTableView *tab=dynamic_cast<BaseTableView *>(item);
 
 		if(rel)
+		{
 			rel->disconnectTables();
+			rel_router.removeRoute(rel);
+		}
+		else if(tab)
+		{
+			for(auto &rel_view : rel_router.removeObstacle(tab))
+				rel_view->requestLineUpdate();
+		}
+
+		//The area occupied by the object is marked as dirty before its removal
+		if(object)
+			object->notifyAreaChange();
 
 		item->setVisible(false);
 		item->setActive(false);
@@ -469,6 +554,8 @@ void ObjectsScene::removeItem(QGraphicsItem *item)
 
 		if(object)
 		{
+			//Since the object isn't in the scene anymore this call only discards the last notified area
+			object->notifyAreaChange();
 			disconnect(object, nullptr, this, nullptr);
 			disconnect(object, nullptr, dynamic_cast<BaseGraphicObject*>(object->getSourceObject()), nullptr);
 			disconnect(dynamic_cast<BaseGraphicObject*>(object->getSourceObject()), nullptr, object, nullptr);
@@ -746,6 +833,8 @@ void ObjectsScene::keyPressEvent(QKeyEvent *event)
 			dy *= 100;
 		}
 
+		RelationshipView::setLineUpdatesDeferred(true);
+
 		for(auto item : selectedItems())
 		{
 			obj_view=dynamic_cast<BaseObjectView *>(item);
@@ -754,6 +843,8 @@ void ObjectsScene::keyPressEvent(QKeyEvent *event)
 				obj_view->moveBy(dx, dy);
 		}
 
+		RelationshipView::setLineUpdatesDeferred(false);
+
 		adjustScenePositionOnKeyEvent(event->key());
 	}
 	else
@@ -834,7 +925,16 @@ void ObjectsScene::mouseMoveEvent(QGraphicsSceneMouseEvent *event)
 	if(rel_line->isVisible())
 		rel_line->setLine(QLineF(rel_line->line().p1(), event->scenePos()));
 
-	QGraphicsScene::mouseMoveEvent(event);
+	if(moving_objs)
+	{
+		/* The relationships connected to the moved objects have their lines configured only
+		once after all the selected objects are moved instead of once per moved table */
+		RelationshipView::setLineUpdatesDeferred(true);
+		QGraphicsScene::mouseMoveEvent(event);
+		RelationshipView::setLineUpdatesDeferred(false);
+	}
+	else
+		QGraphicsScene::mouseMoveEvent(event);
 }
 
 void ObjectsScene::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
@@ -1011,12 +1111,16 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 	{
 		/* Updating relationships related to moved tables. Converting the list of table to a set
 	 in order to remove the duplicated elements */
+		RelationshipView::setLineUpdatesDeferred(true);
+
 		for(auto &obj : tables.toSet())
 		{
 			tab_view=dynamic_cast<BaseTableView *>(obj);
 			if(tab_view)
 				tab_view->requestRelationshipsUpdate();
 		}
+
+		RelationshipView::setLineUpdatesDeferred(false);
 	}
 
 	emit s_objectsMoved(true);
@@ -1162,3 +1266,8 @@ bool ObjectsScene::isMovingObjects(void)
 {
 	return(moving_objs);
 }
+
+RelationshipRouter *ObjectsScene::getRelationshipRouter(void)
+{
+	return(&rel_router);
+}
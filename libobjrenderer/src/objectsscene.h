@@ -32,6 +32,7 @@
 #include "tableview.h"
 #include "schemaview.h"
 #include "styledtextboxview.h"
+#include "relationshiprouter.h"
 
 class ObjectsScene: public QGraphicsScene {
 	private:
@@ -105,6 +106,13 @@ class ObjectsScene: public QGraphicsScene {
 		//! \brief Line used as a guide when inserting new relationship
 		QGraphicsLineItem *rel_line;
 
+		//! \brief Layout engine (spatial index of the tables and routes cache) used by the relationships in routed lines mode
+		RelationshipRouter rel_router;
+
+		/*! \brief Areas (in scene coordinates) changed by the objects that weren't notified yet through s_objectsAreasChanged().
+		The overlapping areas are kept merged (see addDirtyArea()) */
+		QList<QRectF> dirty_areas;
+
 		//! \brief Aligns the specified point in relation to the grid
 		static QPointF alignPointToGrid(const QPointF &pnt);
 
@@ -178,6 +186,13 @@ class ObjectsScene: public QGraphicsScene {
 		bool isRelationshipLineVisible(void);
 		bool isMovingObjects(void);
 
+		//! \brief Returns the layout engine used by the relationships in routed lines mode
+		RelationshipRouter *getRelationshipRouter(void);
+
+		/*! \brief Marks the area (in scene coordinates) as changed by some object (see BaseObjectView::notifyAreaChange()).
+		The areas marked in the same event loop iteration are notified all at once by s_objectsAreasChanged() */
+		void addDirtyArea(const QRectF &area);
+
 	public slots:
 		void alignObjectsToGrid(void);
 		void update(void);
@@ -205,7 +220,18 @@ class ObjectsScene: public QGraphicsScene {
 		//! \brief Handles and redirects the signal emitted by the tables/views when the extended attributes are toggled
 		void emitExtAttributesToggled(void);
 
+		/*! \brief Updates the rectangle of the moved/resized table (the sender) in the relationships' router and
+		requests the line update of the relationships whose routes were invalidated by the change */
+		void updateRoutingObstacle(void);
+
+		//! \brief Emits s_objectsAreasChanged() with the pending dirty areas
+		void emitDirtyAreas(void);
+
 	signals:
+		/*! \brief Signal emitted with the areas (in scene coordinates) changed by objects being added, removed,
+		moved, resized, reconfigured or (un)selected. Overlapping areas are merged before the emission */
+		void s_objectsAreasChanged(const QList<QRectF> &areas);
+
 		//! \brief Signal emitted when the user start or finalizes a object movement.
 		void s_objectsMoved(bool end_moviment);
 
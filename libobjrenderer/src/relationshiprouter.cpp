@@ -0,0 +1,410 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "relationshiprouter.h"
+#include <cmath>
+#include <limits>
+
+vector<pair<int,int>> RelationshipRouter::getCells(const QRectF &rect)
+{
+	vector<pair<int,int>> cells;
+	int x1=static_cast<int>(floor(rect.left()/CELL_SIZE)),
+			x2=static_cast<int>(floor(rect.right()/CELL_SIZE)),
+			y1=static_cast<int>(floor(rect.top()/CELL_SIZE)),
+			y2=static_cast<int>(floor(rect.bottom()/CELL_SIZE));
+
+	for(int x=x1; x <= x2; x++)
+	{
+		for(int y=y1; y <= y2; y++)
+			cells.push_back(make_pair(x, y));
+	}
+
+	return(cells);
+}
+
+vector<QRectF> RelationshipRouter::getObstacles(const QRectF &area)
+{
+	set<BaseTableView *> tables;
+	map<pair<int,int>, set<BaseTableView *>>::iterator itr;
+	vector<QRectF> rects;
+	QRectF rect;
+
+	for(auto &cell : getCells(area))
+	{
+		itr=obstacle_grid.find(cell);
+
+		if(itr!=obstacle_grid.end())
+			tables.insert(itr->second.begin(), itr->second.end());
+	}
+
+	for(auto &table : tables)
+	{
+		rect=obstacles[table].adjusted(-OBSTACLE_MARGIN, -OBSTACLE_MARGIN, OBSTACLE_MARGIN, OBSTACLE_MARGIN);
+
+		if(rect.intersects(area))
+			rects.push_back(rect);
+	}
+
+	return(rects);
+}
+
+bool RelationshipRouter::crossesRect(const QPointF &p1, const QPointF &p2, const QRectF &rect)
+{
+	//Horizontal segment
+	if(p1.y()==p2.y())
+		return(p1.y() > rect.top() && p1.y() < rect.bottom() &&
+					 qMax(p1.x(), p2.x()) > rect.left() && qMin(p1.x(), p2.x()) < rect.right());
+
+	//Vertical segment
+	return(p1.x() > rect.left() && p1.x() < rect.right() &&
+				 qMax(p1.y(), p2.y()) > rect.top() && qMin(p1.y(), p2.y()) < rect.bottom());
+}
+
+QPointF RelationshipRouter::getSidePoint(const QRectF &rect, unsigned side)
+{
+	if(side==LEFT_SIDE)
+		return(QPointF(rect.left(), rect.center().y()));
+	else if(side==RIGHT_SIDE)
+		return(QPointF(rect.right(), rect.center().y()));
+	else if(side==TOP_SIDE)
+		return(QPointF(rect.center().x(), rect.top()));
+	else
+		return(QPointF(rect.center().x(), rect.bottom()));
+}
+
+QPointF RelationshipRouter::getStubPoint(const QPointF &side_pnt, unsigned side)
+{
+	if(side==LEFT_SIDE)
+		return(side_pnt - QPointF(STUB_LENGTH, 0));
+	else if(side==RIGHT_SIDE)
+		return(side_pnt + QPointF(STUB_LENGTH, 0));
+	else if(side==TOP_SIDE)
+		return(side_pnt - QPointF(0, STUB_LENGTH));
+	else
+		return(side_pnt + QPointF(0, STUB_LENGTH));
+}
+
+void RelationshipRouter::simplifyRoute(vector<QPointF> &points)
+{
+	vector<QPointF> aux;
+
+	for(auto &pnt : points)
+	{
+		//Ignoring repeated points
+		if(!aux.empty() && aux.back()==pnt)
+			continue;
+
+		//Replacing the last point when it's collinear to the previous one and the current one
+		if(aux.size() >= 2 &&
+			 ((aux[aux.size()-2].x()==aux.back().x() && aux.back().x()==pnt.x()) ||
+				(aux[aux.size()-2].y()==aux.back().y() && aux.back().y()==pnt.y())))
+			aux.back()=pnt;
+		else
+			aux.push_back(pnt);
+	}
+
+	points.swap(aux);
+}
+
+double RelationshipRouter::getRouteCost(const vector<QPointF> &points, const vector<QRectF> &obst_rects)
+{
+	double cost=0;
+	int count=points.size();
+	vector<QPointF> aux_pnts=points;
+
+	for(int i=0; i < count - 1; i++)
+	{
+		cost+=fabs(points[i+1].x() - points[i].x()) + fabs(points[i+1].y() - points[i].y());
+
+		//The stubs start inside the tables' margins so they aren't checked against the obstacles
+		if(i==0 || i==count - 2)
+			continue;
+
+		for(auto &rect : obst_rects)
+		{
+			if(crossesRect(points[i], points[i+1], rect))
+				cost+=CROSSING_COST;
+		}
+	}
+
+	//The bends are counted only after discarding the collinear points
+	simplifyRoute(aux_pnts);
+
+	return(cost + (qMax(0, static_cast<int>(aux_pnts.size()) - 2) * BEND_COST));
+}
+
+vector<QPointF> RelationshipRouter::computeRoute(const QRectF &src_rect, const QRectF &dst_rect)
+{
+	vector<QPointF> route, best_route;
+	vector<double> xs, ys;
+	vector<QRectF> obst_rects;
+	QPointF src_pnt, dst_pnt, src_stub, dst_stub;
+	double cost=0, best_cost=std::numeric_limits<double>::max();
+	unsigned sides[]={ LEFT_SIDE, TOP_SIDE, RIGHT_SIDE, BOTTOM_SIDE };
+
+	/* Only the tables around the relationship's tables are considered as obstacles. Their borders
+	are used as channels in which the routes can pass beside them */
+	obst_rects=getObstacles(src_rect.united(dst_rect).adjusted(-2 * STUB_LENGTH, -2 * STUB_LENGTH, 2 * STUB_LENGTH, 2 * STUB_LENGTH));
+
+	for(auto &rect : obst_rects)
+	{
+		xs.push_back(rect.left());
+		xs.push_back(rect.right());
+		ys.push_back(rect.top());
+		ys.push_back(rect.bottom());
+	}
+
+	for(auto &src_side : sides)
+	{
+		for(auto &dst_side : sides)
+		{
+			src_pnt=getSidePoint(src_rect, src_side);
+			dst_pnt=getSidePoint(dst_rect, dst_side);
+			src_stub=getStubPoint(src_pnt, src_side);
+			dst_stub=getStubPoint(dst_pnt, dst_side);
+
+			//Besides the obstacles' channels the routes can bend in the middle of the stubs or at the stubs themselves
+			xs.insert(xs.end(), { (src_stub.x() + dst_stub.x())/2, src_stub.x(), dst_stub.x() });
+			ys.insert(ys.end(), { (src_stub.y() + dst_stub.y())/2, src_stub.y(), dst_stub.y() });
+
+			//Routes in the form horizontal-vertical-horizontal passing through the channel x
+			for(auto &x : xs)
+			{
+				route={ src_pnt, src_stub, QPointF(x, src_stub.y()), QPointF(x, dst_stub.y()), dst_stub, dst_pnt };
+				cost=getRouteCost(route, obst_rects);
+
+				if(cost < best_cost)
+				{
+					best_cost=cost;
+					best_route.swap(route);
+				}
+			}
+
+			//Routes in the form vertical-horizontal-vertical passing through the channel y
+			for(auto &y : ys)
+			{
+				route={ src_pnt, src_stub, QPointF(src_stub.x(), y), QPointF(dst_stub.x(), y), dst_stub, dst_pnt };
+				cost=getRouteCost(route, obst_rects);
+
+				if(cost < best_cost)
+				{
+					best_cost=cost;
+					best_route.swap(route);
+				}
+			}
+
+			xs.resize(xs.size() - 3);
+			ys.resize(ys.size() - 3);
+		}
+	}
+
+	simplifyRoute(best_route);
+	return(best_route);
+}
+
+void RelationshipRouter::indexRoute(RelationshipView *rel, RouteInfo &route)
+{
+	QRectF rect;
+
+	route.cells.clear();
+
+	for(unsigned i=0; i + 1 < route.points.size(); i++)
+	{
+		rect=QRectF(route.points[i], route.points[i+1]).normalized();
+
+		for(auto &cell : getCells(rect))
+		{
+			route_grid[cell].insert(rel);
+			route.cells.push_back(cell);
+		}
+	}
+}
+
+void RelationshipRouter::unindexRoute(RelationshipView *rel, RouteInfo &route)
+{
+	map<pair<int,int>, set<RelationshipView *>>::iterator itr;
+
+	for(auto &cell : route.cells)
+	{
+		itr=route_grid.find(cell);
+
+		if(itr!=route_grid.end())
+		{
+			itr->second.erase(rel);
+
+			if(itr->second.empty())
+				route_grid.erase(itr);
+		}
+	}
+
+	route.cells.clear();
+}
+
+vector<RelationshipView *> RelationshipRouter::invalidateRoutes(const QRectF &area, BaseTableView *table)
+{
+	set<RelationshipView *> rels;
+	vector<RelationshipView *> invalid_rels;
+	map<pair<int,int>, set<RelationshipView *>>::iterator itr;
+
+	for(auto &cell : getCells(area))
+	{
+		itr=route_grid.find(cell);
+
+		if(itr!=route_grid.end())
+			rels.insert(itr->second.begin(), itr->second.end());
+	}
+
+	for(auto &rel : rels)
+	{
+		RouteInfo &route=routes[rel];
+
+		//The routes connected to the table are recomputed anyway since they are keyed on the table's geometry
+		if(!route.valid || route.tables[0]==table || route.tables[1]==table)
+			continue;
+
+		for(unsigned i=0; i + 1 < route.points.size(); i++)
+		{
+			if(crossesRect(route.points[i], route.points[i+1], area))
+			{
+				route.valid=false;
+				invalid_rels.push_back(rel);
+				break;
+			}
+		}
+	}
+
+	return(invalid_rels);
+}
+
+vector<RelationshipView *> RelationshipRouter::updateObstacle(BaseTableView *table, const QRectF &rect)
+{
+	vector<RelationshipView *> invalid_rels, aux_rels;
+	map<BaseTableView *, QRectF>::iterator itr=obstacles.find(table);
+
+	if(!table)
+		return(invalid_rels);
+
+	if(itr!=obstacles.end())
+	{
+		if(itr->second==rect)
+			return(invalid_rels);
+
+		invalid_rels=removeObstacle(table);
+	}
+
+	obstacles[table]=rect;
+
+	for(auto &cell : getCells(rect))
+		obstacle_grid[cell].insert(table);
+
+	/* The area checked is wider than the obstacle's margin so the routes that pass through
+	the channels beside the table are also recomputed */
+	aux_rels=invalidateRoutes(rect.adjusted(-2 * OBSTACLE_MARGIN, -2 * OBSTACLE_MARGIN, 2 * OBSTACLE_MARGIN, 2 * OBSTACLE_MARGIN), table);
+	invalid_rels.insert(invalid_rels.end(), aux_rels.begin(), aux_rels.end());
+
+	return(invalid_rels);
+}
+
+vector<RelationshipView *> RelationshipRouter::removeObstacle(BaseTableView *table)
+{
+	map<BaseTableView *, QRectF>::iterator itr=obstacles.find(table);
+	map<pair<int,int>, set<BaseTableView *>>::iterator cell_itr;
+	QRectF rect;
+
+	if(itr==obstacles.end())
+		return(vector<RelationshipView *>());
+
+	rect=itr->second;
+	obstacles.erase(itr);
+
+	for(auto &cell : getCells(rect))
+	{
+		cell_itr=obstacle_grid.find(cell);
+
+		if(cell_itr!=obstacle_grid.end())
+		{
+			cell_itr->second.erase(table);
+
+			if(cell_itr->second.empty())
+				obstacle_grid.erase(cell_itr);
+		}
+	}
+
+	return(invalidateRoutes(rect.adjusted(-2 * OBSTACLE_MARGIN, -2 * OBSTACLE_MARGIN, 2 * OBSTACLE_MARGIN, 2 * OBSTACLE_MARGIN), table));
+}
+
+vector<QPointF> RelationshipRouter::getRoute(RelationshipView *rel, BaseTableView *src_tab, BaseTableView *dst_tab,
+																							const QRectF &src_rect, const QRectF &dst_rect, vector<RelationshipView *> &invalid_rels)
+{
+	map<RelationshipView *, RouteInfo>::iterator itr;
+	vector<RelationshipView *> aux_rels;
+
+	/* Normally the tables are already updated in the index when their movement is notified. The routes eventually
+	invalidated here are handed to the caller so the lines of their relationships can be reconfigured */
+	for(unsigned i=0; i < 2; i++)
+	{
+		aux_rels=updateObstacle(i==0 ? src_tab : dst_tab, i==0 ? src_rect : dst_rect);
+		invalid_rels.insert(invalid_rels.end(), aux_rels.begin(), aux_rels.end());
+	}
+
+	itr=routes.find(rel);
+
+	if(itr!=routes.end())
+	{
+		RouteInfo &route=itr->second;
+
+		if(route.valid &&
+			 route.tables[0]==src_tab && route.tables[1]==dst_tab &&
+			 route.rects[0]==src_rect && route.rects[1]==dst_rect)
+			return(route.points);
+
+		unindexRoute(rel, route);
+	}
+
+	RouteInfo &route=routes[rel];
+
+	route.tables[0]=src_tab;
+	route.tables[1]=dst_tab;
+	route.rects[0]=src_rect;
+	route.rects[1]=dst_rect;
+	route.points=computeRoute(src_rect, dst_rect);
+	route.valid=true;
+	indexRoute(rel, route);
+
+	return(route.points);
+}
+
+void RelationshipRouter::removeRoute(RelationshipView *rel)
+{
+	map<RelationshipView *, RouteInfo>::iterator itr=routes.find(rel);
+
+	if(itr!=routes.end())
+	{
+		unindexRoute(rel, itr->second);
+		routes.erase(itr);
+	}
+}
+
+void RelationshipRouter::clear(void)
+{
+	obstacles.clear();
+	obstacle_grid.clear();
+	routes.clear();
+	route_grid.clear();
+}
@@ -0,0 +1,141 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libobjrenderer
+\class RelationshipRouter
+\brief Implements the layout engine used by the relationships in the routed lines connection mode. The tables' rectangles
+are stored in a spatial index (a uniform grid) so the obstacles around a relationship are retrieved without scanning the whole model.
+Each route is composed only by horizontal and vertical segments and is chosen among several candidates (different table sides and
+channels passing beside the nearby tables) by its length, amount of bends and amount of tables crossed. The routes are cached per
+relationship and keyed on the geometry of the connected tables. A cached route is discarded only when one of its tables changes or
+when another table is placed over (or removed from) the area the route passes through.
+*/
+
+#ifndef RELATIONSHIP_ROUTER_H
+#define RELATIONSHIP_ROUTER_H
+
+#include <QRectF>
+#include <map>
+#include <set>
+#include "exception.h"
+
+class BaseTableView;
+class RelationshipView;
+
+class RelationshipRouter {
+	private:
+		//! \brief Size of the cells of the grid used to index the tables and the routes
+		static constexpr double CELL_SIZE=250.0f;
+
+		//! \brief Minimum distance kept between the routes and the tables' borders
+		static constexpr double OBSTACLE_MARGIN=10.0f;
+
+		//! \brief Length of the first/last segment of a route (perpendicular to the connected table's side)
+		static constexpr double STUB_LENGTH=20.0f;
+
+		//! \brief Cost added to a candidate route for each bend
+		static constexpr double BEND_COST=30.0f;
+
+		//! \brief Cost added to a candidate route for each table crossed by one of its segments
+		static constexpr double CROSSING_COST=10000.0f;
+
+		static const unsigned LEFT_SIDE=0,
+		TOP_SIDE=1,
+		RIGHT_SIDE=2,
+		BOTTOM_SIDE=3;
+
+		//! \brief Stores a computed route and the geometry of the tables used to compute it
+		struct RouteInfo {
+			BaseTableView *tables[2];
+			QRectF rects[2];
+			vector<QPointF> points;
+			vector<pair<int,int>> cells;
+			bool valid;
+		};
+
+		//! \brief Current rectangle of each indexed table
+		map<BaseTableView *, QRectF> obstacles;
+
+		//! \brief Spatial index of the tables. Each grid cell stores the tables that overlap it
+		map<pair<int,int>, set<BaseTableView *>> obstacle_grid;
+
+		//! \brief Cached routes per relationship
+		map<RelationshipView *, RouteInfo> routes;
+
+		//! \brief Spatial index of the cached routes. Each grid cell stores the relationships whose route passes through it
+		map<pair<int,int>, set<RelationshipView *>> route_grid;
+
+		//! \brief Returns the grid cells covered by the provided rectangle
+		vector<pair<int,int>> getCells(const QRectF &rect);
+
+		//! \brief Returns the rectangles (expanded by OBSTACLE_MARGIN) of the indexed tables that intersect the provided area
+		vector<QRectF> getObstacles(const QRectF &area);
+
+		//! \brief Returns true when the horizontal or vertical segment formed by the two points passes through the rectangle's interior
+		static bool crossesRect(const QPointF &p1, const QPointF &p2, const QRectF &rect);
+
+		//! \brief Returns the middle point of the specified rectangle's side
+		static QPointF getSidePoint(const QRectF &rect, unsigned side);
+
+		//! \brief Returns the point that ends the stub started at the specified side point
+		static QPointF getStubPoint(const QPointF &side_pnt, unsigned side);
+
+		//! \brief Removes the repeated and the collinear points of the route
+		static void simplifyRoute(vector<QPointF> &points);
+
+		/*! \brief Returns the cost of the route considering its length, bends and the amount of obstacles crossed. The route
+		must be provided without simplification so its first and last segments are the stubs (which aren't checked for crossings) */
+		static double getRouteCost(const vector<QPointF> &points, const vector<QRectF> &obst_rects);
+
+		//! \brief Computes the best route between the two tables' rectangles
+		vector<QPointF> computeRoute(const QRectF &src_rect, const QRectF &dst_rect);
+
+		//! \brief Inserts/removes the cached route of the relationship in the spatial index
+		void indexRoute(RelationshipView *rel, RouteInfo &route);
+		void unindexRoute(RelationshipView *rel, RouteInfo &route);
+
+		/*! \brief Marks as invalid the routes (not connected to the provided table) that pass through the area
+		returning the relationships which routes need to be recomputed */
+		vector<RelationshipView *> invalidateRoutes(const QRectF &area, BaseTableView *table);
+
+	public:
+		/*! \brief Inserts or updates the table's rectangle in the spatial index. Returns the relationships not connected
+		to the table whose routes were invalidated because they pass through the table's former or current area */
+		vector<RelationshipView *> updateObstacle(BaseTableView *table, const QRectF &rect);
+
+		/*! \brief Removes the table from the spatial index. Returns the relationships whose routes
+		were invalidated because they pass beside the table's former area */
+		vector<RelationshipView *> removeObstacle(BaseTableView *table);
+
+		/*! \brief Returns the route (first and last points on the tables' sides) between the two tables of the relationship.
+		The cached route is returned when it's still valid and the tables' rectangles are the same used to compute it.
+		The tables' rectangles are updated in the index so the other relationships whose routes were invalidated
+		by that update are appended to invalid_rels (their lines must be reconfigured by the caller) */
+		vector<QPointF> getRoute(RelationshipView *rel, BaseTableView *src_tab, BaseTableView *dst_tab,
+														 const QRectF &src_rect, const QRectF &dst_rect, vector<RelationshipView *> &invalid_rels);
+
+		//! \brief Removes the cached route of the relationship
+		void removeRoute(RelationshipView *rel);
+
+		//! \brief Removes all the indexed tables and cached routes
+		void clear(void);
+};
+
+#endif
@@ -17,11 +17,14 @@
 */
 
 #include "relationshipview.h"
+#include "objectsscene.h"
 
 bool RelationshipView::hide_name_label=false;
 bool RelationshipView::use_curved_lines=true;
 bool RelationshipView::use_crows_foot=false;
 unsigned RelationshipView::line_conn_mode=RelationshipView::CONNECT_FK_TO_PK;
+bool RelationshipView::defer_line_updates=false;
+vector<RelationshipView *> RelationshipView::pending_line_updates;
 
 RelationshipView::RelationshipView(BaseRelationship *rel) : BaseObjectView(rel)
 {
@@ -35,6 +38,7 @@ RelationshipView::RelationshipView(BaseRelationship *rel) : BaseObjectView(rel)
 		{
 			labels[i]=new TextboxView(rel->getLabel(i), true);
 			labels[i]->setZValue(i==BaseRelationship::REL_NAME_LABEL ? 1 : 2);
+			labels[i]->setGraphicsEffect(new LevelOfDetailEffect);
 			this->addToGroup(labels[i]);
 		}
 		else
@@ -43,15 +47,19 @@ RelationshipView::RelationshipView(BaseRelationship *rel) : BaseObjectView(rel)
 
 	sel_object=nullptr;
 	sel_object_idx=-1;
-	configuring_line=false;
+	configuring_line=line_update_pending=false;
 	using_placeholders=BaseObjectView::isPlaceholderEnabled();
 
+	/* When the relationship is too small to have its details readable only the lines are drawn,
+	so labels, descriptors and attributes are painted through a level of detail effect */
 	descriptor=new QGraphicsPolygonItem;
 	descriptor->setZValue(0);
+	descriptor->setGraphicsEffect(new LevelOfDetailEffect);
 	this->addToGroup(descriptor);
 
 	obj_shadow=new QGraphicsPolygonItem;
 	obj_shadow->setZValue(-1);
+	obj_shadow->setGraphicsEffect(new LevelOfDetailEffect);
 	this->addToGroup(obj_shadow);
 
 	obj_selection=new QGraphicsPolygonItem;
@@ -82,6 +90,13 @@ RelationshipView::~RelationshipView(void)
 {
 	QGraphicsItem *item=nullptr;
 	vector<vector<QGraphicsLineItem *> *> rel_lines = { &lines, &fk_lines, &pk_lines, &src_cf_lines, &dst_cf_lines };
+	ObjectsScene *obj_scene=dynamic_cast<ObjectsScene *>(this->scene());
+
+	if(line_update_pending)
+		pending_line_updates.erase(find(pending_line_updates.begin(), pending_line_updates.end(), this));
+
+	if(obj_scene)
+		obj_scene->getRelationshipRouter()->removeRoute(this);
 
 	while(!curves.empty())
 	{
@@ -184,8 +199,8 @@ void RelationshipView::setLineConnectionMode(unsigned mode)
 		line_conn_mode=CONNECT_TABLE_EGDES;
 	else
 	{
-		if(mode > CONNECT_TABLE_EGDES)
-			mode=CONNECT_TABLE_EGDES;
+		if(mode > CONNECT_ROUTED_LINES)
+			mode=CONNECT_ROUTED_LINES;
 
 		line_conn_mode=mode;
 	}
@@ -196,6 +211,35 @@ unsigned RelationshipView::getLineConnectinMode(void)
 	return(line_conn_mode);
 }
 
+void RelationshipView::setLineUpdatesDeferred(bool value)
+{
+	vector<RelationshipView *> rels;
+
+	defer_line_updates=value;
+
+	if(!defer_line_updates)
+	{
+		rels.swap(pending_line_updates);
+
+		for(auto &rel : rels)
+		{
+			rel->line_update_pending=false;
+			rel->__configureLine(false);
+		}
+	}
+}
+
+void RelationshipView::requestLineUpdate(void)
+{
+	if(!defer_line_updates)
+		__configureLine(false);
+	else if(!line_update_pending)
+	{
+		line_update_pending=true;
+		pending_line_updates.push_back(this);
+	}
+}
+
 QPointF RelationshipView::getConnectionPoint(unsigned table_idx)
 {
 	if(table_idx > 2)
@@ -333,6 +377,7 @@ QVariant RelationshipView::itemChange(GraphicsItemChange change, const QVariant
 		for(i=0; i < count; i++)
 			attributes[i]->childItems().at(3)->setVisible(value.toBool());
 
+		notifyAreaChange();
 		emit s_objectSelected(dynamic_cast<BaseGraphicObject *>(this->getSourceObject()),	value.toBool());
 	}
 
@@ -535,9 +580,9 @@ void RelationshipView::connectTables(void)
 			tables[i]->disconnect(this);
 
 			if(BaseObjectView::isPlaceholderEnabled())
-				connect(tables[i], SIGNAL(s_relUpdateRequest(void)), this, SLOT(configureLine(void)));
+				connect(tables[i], SIGNAL(s_relUpdateRequest(void)), this, SLOT(requestLineUpdate(void)));
 			else
-				connect(tables[i], SIGNAL(s_objectMoved(void)), this, SLOT(configureLine(void)));
+				connect(tables[i], SIGNAL(s_objectMoved(void)), this, SLOT(requestLineUpdate(void)));
 
 			connect(tables[i], SIGNAL(s_objectDimensionChanged(void)), this, SLOT(configureLine(void)));
 		}
@@ -574,6 +619,11 @@ void RelationshipView::configurePositionInfo(void)
 }
 
 void RelationshipView::configureLine(void)
+{
+	__configureLine(true);
+}
+
+void RelationshipView::__configureLine(bool force_update)
 {
 	//Reconnect the tables is the placeholder usage changes
 	if(using_placeholders!=BaseObjectView::isPlaceholderEnabled())
@@ -586,6 +636,7 @@ void RelationshipView::configureLine(void)
 	{
 		BaseRelationship *base_rel=this->getSourceObject();
 		Relationship *rel=dynamic_cast<Relationship *>(base_rel);
+		ObjectsScene *obj_scene=dynamic_cast<ObjectsScene *>(this->scene());
 		vector<QPointF> points, fk_points, pk_points;
 		QGraphicsLineItem *lin=nullptr;
 		QPointF pos, p_int, p_central[2], pk_pnt, fk_pnt;
@@ -594,12 +645,23 @@ void RelationshipView::configureLine(void)
 		QGraphicsPolygonItem *pol=nullptr;
 		QPolygonF pol_aux;
 		QString tool_tip;
+		vector<QPointF> line_geom;
+		vector<RelationshipView *> invalid_rels;
 		QGraphicsItem *item=nullptr;
 		int i, i1, count, idx_lin_desc=0;
 		bool conn_same_sides = false, bidirectional=base_rel->isBidirectional(),
 				conn_horiz_sides[2] = { false, false }, conn_vert_sides[2] = { false, false };
 		unsigned rel_type = base_rel->getRelationshipType();
 
+		//Reconfigures the relationships whose routes were invalidated when the tables were updated in the router
+		auto updateInvalidRoutes=[&invalid_rels, this](){
+			for(auto &rel_view : invalid_rels)
+			{
+				if(rel_view!=this)
+					rel_view->requestLineUpdate();
+			}
+		};
+
 		configuring_line=true;
 		pen.setCapStyle(Qt::RoundCap);
 
@@ -656,7 +718,8 @@ void RelationshipView::configureLine(void)
 				tables[1]=dynamic_cast<BaseTableView *>(rel->getReceiverTable()->getReceiverObject());
 			}
 
-			if(line_conn_mode==CONNECT_CENTER_PNTS || line_conn_mode==CONNECT_TABLE_EGDES || !rel_1n)
+			if(line_conn_mode==CONNECT_CENTER_PNTS || line_conn_mode==CONNECT_TABLE_EGDES ||
+				 line_conn_mode==CONNECT_ROUTED_LINES || !rel_1n)
 			{
 				vector<vector<QGraphicsLineItem *> *> ref_lines={ &fk_lines, &pk_lines };
 
@@ -826,7 +889,19 @@ void RelationshipView::configureLine(void)
 			}
 		}
 
-		if(base_rel->isSelfRelationship() || line_conn_mode != CONNECT_TABLE_EGDES)
+		if(!base_rel->isSelfRelationship() && line_conn_mode == CONNECT_ROUTED_LINES && points.empty() && obj_scene)
+		{
+			/* The route is retrieved from the scene's router which reuses the last computed route
+			while the tables' rectangles and the tables around it remain the same */
+			points=obj_scene->getRelationshipRouter()->getRoute(this, tables[0], tables[1],
+																													QRectF(tables[0]->pos(), tables[0]->boundingRect().size()),
+																													QRectF(tables[1]->pos(), tables[1]->boundingRect().size()),
+																													invalid_rels);
+			conn_points[0]=p_central[0]=points.front();
+			conn_points[1]=p_central[1]=points.back();
+		}
+		else if(base_rel->isSelfRelationship() ||
+						(line_conn_mode != CONNECT_TABLE_EGDES && line_conn_mode != CONNECT_ROUTED_LINES))
 		{
 			conn_points[0]=p_central[0];
 			conn_points[1]=p_central[1];
@@ -834,7 +909,8 @@ void RelationshipView::configureLine(void)
 			points.insert(points.begin(),p_central[0]);
 			points.push_back(p_central[1]);
 		}
-		else if(line_conn_mode == CONNECT_TABLE_EGDES)
+		//Connecting the lines on the tables' edges (also used in routed lines mode when the user added points to the line)
+		else
 		{
 			QRectF brect;
 			QPolygonF pol;
@@ -951,6 +1027,29 @@ void RelationshipView::configureLine(void)
 			points.push_back(p_central[1]);
 		}
 
+		/* Storing the geometry in which the line is based (tables' rects, line points and connection points).
+		When the update was requested by the tables and that geometry is the same used in the
+		last configuration the remaining of the relationship doesn't need to be reconfigured */
+		for(i=0; i < 2; i++)
+		{
+			rect=QRectF(tables[i]->pos(), tables[i]->boundingRect().size());
+			line_geom.push_back(rect.topLeft());
+			line_geom.push_back(rect.bottomRight());
+		}
+
+		line_geom.insert(line_geom.end(), points.begin(), points.end());
+		line_geom.insert(line_geom.end(), fk_points.begin(), fk_points.end());
+		line_geom.insert(line_geom.end(), pk_points.begin(), pk_points.end());
+
+		if(!force_update && line_geom==curr_line_geom)
+		{
+			configuring_line=false;
+			updateInvalidRoutes();
+			return;
+		}
+
+		curr_line_geom.swap(line_geom);
+
 		//If the relationship is selected we do not change the lines colors
 		if(this->isSelected() && !lines.empty())
 			pen = lines[0]->pen();
@@ -1176,6 +1275,7 @@ void RelationshipView::configureLine(void)
 		this->configureProtectedIcon();
 
 		configuring_line=false;
+		notifyAreaChange();
 
 		/* Making a little tweak on the foreign key type name. Despite being of class BaseRelationship,
 		for semantics purposes shows the type of this relationship as "Relationship" unlike "Link" */
@@ -1196,6 +1296,7 @@ void RelationshipView::configureLine(void)
 		}
 
 		descriptor->setToolTip(tool_tip);
+		updateInvalidRoutes();
 	}
 }
 
@@ -1433,6 +1534,7 @@ void RelationshipView::configureCrowsFootDescriptors(void)
 			for(int idx = 0; idx < 2; idx++)
 			{
 				cf_descriptors[idx] = new QGraphicsItemGroup;
+				cf_descriptors[idx]->setGraphicsEffect(new LevelOfDetailEffect);
 				round_cf_descriptors[idx] = new QGraphicsEllipseItem;
 				this->addToGroup(cf_descriptors[idx]);
 			}
@@ -1665,6 +1767,7 @@ void RelationshipView::configureAttributes(void)
 			{
 				attrib=new QGraphicsItemGroup;
 				attrib->setZValue(-1);
+				attrib->setGraphicsEffect(new LevelOfDetailEffect);
 
 				//Creates the line that connects the attribute to the relationship descriptor
 				lin=new QGraphicsLineItem;
@@ -29,6 +29,7 @@
 #include "tableview.h"
 #include "relationship.h"
 #include "beziercurveitem.h"
+#include "levelofdetaileffect.h"
 
 class RelationshipView: public BaseObjectView {
 	private:
@@ -51,15 +52,26 @@ class RelationshipView: public BaseObjectView {
 
 		/*! \brief Specify the type of connection used by the lines. The first (classical)
 		is to connect the line to tables through their central points. The second (better semantics)
-		makes the line start from the fk columns on receiver table and connecting to the pk columns on reference table */
+		makes the line start from the fk columns on receiver table and connecting to the pk columns on reference table.
+		The third connects the lines on the tables' edges and the fourth routes the lines around the tables (see RelationshipRouter) */
 		static unsigned line_conn_mode;
 
+		/*! \brief Indicates that the line updates requested by the tables' movement must be postponed until
+		the deferring is disabled (see setLineUpdatesDeferred()) */
+		static bool defer_line_updates;
+
+		//! \brief Stores the relationships which line update is postponed
+		static vector<RelationshipView *> pending_line_updates;
+
 		/*! \brief Indicate that the line is being configured/updated. This flag is used to evict
 		 that the configureLine() method is exceedingly called during the table moving. */
 		bool configuring_line,
 
 		//! \brief Indicates if the instance is configured to use placeholders
-		using_placeholders;
+		using_placeholders,
+
+		//! \brief Indicates that the relationship is in the list of postponed line updates
+		line_update_pending;
 
 		//! \brief Stores the graphical representation for labels
 		TextboxView *labels[3];
@@ -113,6 +125,14 @@ class RelationshipView: public BaseObjectView {
 		//! \brief Stores the selected child object index
 		int sel_object_idx;
 
+		/*! \brief Stores the geometry used in the last line configuration: the tables' rects followed
+		by the line points and the fk/pk connection points */
+		vector<QPointF> curr_line_geom;
+
+		/*! \brief Configures the relationship line. When force_update is false and the tables' rects and line points
+		are the same used in the last configuration the line, descriptors and labels are left untouched */
+		void __configureLine(bool force_update);
+
 		//! \brief Configures the labels positioning
 		void configureLabels(void);
 
@@ -157,10 +177,15 @@ class RelationshipView: public BaseObjectView {
 		//! \brief Makes the comple relationship configuration
 		void configureObject(void);
 
+		/*! \brief Configures the relationship line (only if its geometry changed) or, if the line updates
+		are being deferred, postpones the configuration. This slot handles the tables' movement signals */
+		void requestLineUpdate(void);
+
 	public:
 		static const unsigned CONNECT_CENTER_PNTS=0,
 		CONNECT_FK_TO_PK=1,
-		CONNECT_TABLE_EGDES=2;
+		CONNECT_TABLE_EGDES=2,
+		CONNECT_ROUTED_LINES=3;
 
 		RelationshipView(BaseRelationship *rel);
 		~RelationshipView(void);
@@ -192,12 +217,20 @@ class RelationshipView: public BaseObjectView {
 		/*! \brief Configures the mode in which the lines are connected on tables.
 		The first one is the CONNECT_CENTER_PNTS (the classical one) which connects the
 		two tables through the center points. The CONNECT_FK_TO_PK is the one with a better
-		semantics	and connects the fk columns of receiver table to pk columns on reference table */
+		semantics	and connects the fk columns of receiver table to pk columns on reference table.
+		The CONNECT_ROUTED_LINES uses horizontal and vertical segments that avoid crossing the
+		tables. Relationships with user added points are connected on the tables' edges in this mode */
 		static void setLineConnectionMode(unsigned mode);
 
 		//! \brief Returns the line connection mode used for the relationships
 		static unsigned getLineConnectinMode(void);
 
+		/*! \brief Toggles the deferring of the line updates requested by the tables' movement. While deferred,
+		each relationship affected by moved tables is stored only once and, when the deferring is disabled,
+		all of them have their lines configured. This avoids configuring the same line several times when
+		many objects are moved at once. This applies to all relationship instances */
+		static void setLineUpdatesDeferred(bool value);
+
 		/*! \brief Returns the connection point for the specified table. The connection point is
 		 where the relationship is connected on envolved tables. The point returned deffers depending on the
 		 line connection mode used.	*/
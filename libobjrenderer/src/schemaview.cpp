@@ -255,4 +255,6 @@ void SchemaView::configureObject(void)
 	}
 	else
 		this->setVisible(false);
+
+	this->notifyAreaChange();
 }
@@ -51,4 +51,5 @@ void StyledTextboxView::configureObject(void)
 
 	this->configureObjectShadow();
 	this->configureObjectSelection();
+	this->notifyAreaChange();
 }
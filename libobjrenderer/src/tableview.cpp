@@ -200,6 +200,7 @@ void TableView::configureObject(void)
 	BaseObjectView::configureObjectSelection();
 	configureTag();
 	configureSQLDisabledInfo();
+	notifyAreaChange();
 
 	if((old_width!=0 && this->bounding_rect.width()!=old_width) ||
 			(old_height!=0 && this->bounding_rect.height()!=old_height))
@@ -146,6 +146,7 @@ void TextboxView::configureObject(void)
 	this->__configureObject();
 	this->configureObjectShadow();
 	this->configureObjectSelection();
+	this->notifyAreaChange();
 }
 
 void TextboxView::configureObjectShadow(void)
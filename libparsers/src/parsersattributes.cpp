@@ -98,6 +98,7 @@ namespace ParsersAttributes {
 	CONNECT_CENTER_PNTS=QString("center-pnts"),
 	CONNECT_FK_TO_PK=QString("fk-to-pk"),
 	CONNECT_TABLE_EDGES=QString("table-edges"),
+	CONNECT_ROUTED_LINES=QString("routed-lines"),
 	CONNECT_PRIV=QString("connect"),
 	CONNECTION=QString("connection"),
 	CONNECTIONS=QString("connections"),
@@ -113,6 +113,7 @@ namespace ParsersAttributes {
 	CONNECT_CENTER_PNTS,
 	CONNECT_FK_TO_PK,
 	CONNECT_TABLE_EDGES,
+	CONNECT_ROUTED_LINES,
 	CONNECT_PRIV,
 	CONNECTION,
 	CONNECTIONS,
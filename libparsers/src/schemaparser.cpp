@@ -61,6 +61,9 @@ const QString SchemaParser::TOKEN_LT_EQ_OP=QString("<=");
 
 const QRegExp SchemaParser::ATTR_REGEXP=QRegExp("^([a-z])([a-z]*|(\\d)*|(\\-)*|(_)*)+", Qt::CaseInsensitive);
 
+map<QString, SchemaParser::CachedBuffer> SchemaParser::cached_buffers;
+QMutex SchemaParser::cache_mutex;
+
 SchemaParser::SchemaParser(void)
 {
 	line=column=comment_count=0;
@@ -179,26 +182,51 @@ void SchemaParser::loadFile(const QString &filename)
 {
 	if(!filename.isEmpty())
 	{
-		QFile input;
-		QString buf;
+		QFileInfo fi(filename);
+		QMutexLocker locker(&cache_mutex);
+		map<QString, CachedBuffer>::iterator itr=cached_buffers.find(filename);
+
+		//Reusing the cached buffer if the file wasn't changed since it was read
+		if(itr!=cached_buffers.end() &&
+			 itr->second.last_modified==fi.lastModified() &&
+			 itr->second.size==fi.size())
+		{
+			restartParser();
+			buffer=itr->second.buffer;
+			comment_count=itr->second.comment_count;
+		}
+		else
+		{
+			QFile input;
+			QString buf;
+
+			//Open the file for reading
+			input.setFileName(filename);
+			input.open(QFile::ReadOnly);
 
-		//Open the file for reading
-		input.setFileName(filename);
-		input.open(QFile::ReadOnly);
+			if(!input.isOpen())
+				throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED).arg(filename),
+								ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		if(!input.isOpen())
-			throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED).arg(filename),
-							ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			buf=input.readAll();
+			input.close();
 
-		buf=input.readAll();
-		input.close();
+			//Loads the parser buffer
+			loadBuffer(buf);
+
+			cached_buffers[filename]={ fi.lastModified(), fi.size(), buffer, comment_count };
+		}
 
-		//Loads the parser buffer
-		loadBuffer(buf);
 		SchemaParser::filename=filename;
 	}
 }
 
+void SchemaParser::clearCache(void)
+{
+	QMutexLocker locker(&cache_mutex);
+	cached_buffers.clear();
+}
+
 QString SchemaParser::getAttribute(void)
 {
 	QString atrib, current_line;
@@ -249,7 +277,7 @@ QString SchemaParser::getAttribute(void)
 						.arg(filename).arg((line + comment_count + 1)).arg((column+1)),
 						ERR_INV_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
-	else if(!ATTR_REGEXP.exactMatch(atrib))
+	else if(!QRegExp(ATTR_REGEXP).exactMatch(atrib))
 	{
 		throw Exception(QString(Exception::getErrorMessage(ERR_INV_ATTRIBUTE))
 						.arg(atrib).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
@@ -642,7 +670,7 @@ void SchemaParser::defineAttribute(void)
 		attrib=(use_val_as_name ? attributes[new_attrib] : new_attrib);
 
 		//Checking if the attribute has a valid name
-		if(!ATTR_REGEXP.exactMatch(attrib))
+		if(!QRegExp(ATTR_REGEXP).exactMatch(attrib))
 		{
 			throw Exception(QString(Exception::getErrorMessage(ERR_INV_ATTRIBUTE))
 							.arg(attrib).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
@@ -688,7 +716,7 @@ void SchemaParser::unsetAttribute(void)
 										.arg(attrib).arg(filename).arg((line + comment_count +1)).arg((column+1)),
 										ERR_UNK_ATTRIBUTE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 					}
-					else if(!ATTR_REGEXP.exactMatch(attrib))
+					else if(!QRegExp(ATTR_REGEXP).exactMatch(attrib))
 					{
 						throw Exception(QString(Exception::getErrorMessage(ERR_INV_ATTRIBUTE))
 										.arg(attrib).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
@@ -30,6 +30,8 @@
 #include <map>
 #include <vector>
 #include <QDir>
+#include <QDateTime>
+#include <QMutex>
 #include <QTextStream>
 #include "xmlparser.h"
 #include "attribsmap.h"
@@ -90,7 +92,8 @@ class SchemaParser {
 		TOKEN_GT_EQ_OP,// >= (greater or equal to)
 		TOKEN_LT_EQ_OP;// <= (less or equal to)
 
-		//! \brief RegExp used to validate attribute names
+		/*! \brief RegExp used to validate attribute names. Since QRegExp stores the matching state internally
+		this object must be copied before use so parsers running in different threads don't share that state */
 		static const QRegExp ATTR_REGEXP;
 
 		//! \brief Get an attribute name from the buffer on the current position
@@ -185,6 +188,23 @@ class SchemaParser {
 		//! \brief PostgreSQL version currently used by the parser
 		QString pgsql_version;
 
+		//! \brief Stores the preprocessed buffer of a schema file as well the file's state when it was read
+		struct CachedBuffer {
+			QDateTime last_modified;
+			qint64 size;
+			QStringList buffer;
+			int comment_count;
+		};
+
+		/*! \brief Process-wide cache of the preprocessed schema files (indexed by their paths). This cache
+		is shared by all parser instances avoiding reading and preprocessing the same schema files over and
+		over when generating code for several objects. A cached buffer is discarded as soon as the
+		related file is changed on disk */
+		static map<QString, CachedBuffer> cached_buffers;
+
+		//! \brief Serializes the access to the schema files cache
+		static QMutex cache_mutex;
+
 	public:
 		//! \brief Constants used to get a specific object definition
 		static const unsigned SQL_DEFINITION=0,
@@ -216,9 +236,13 @@ class SchemaParser {
 		//! \brief Loads the buffer with a string
 		void loadBuffer(const QString &buf);
 
-		//! \brief Loads a schema file and inserts its line into the parser's buffer
+		/*! \brief Loads a schema file and inserts its line into the parser's buffer. The file is read from disk only
+		when it isn't in the schema files cache or when it was changed since the last time it was read */
 		void loadFile(const QString &filename);
 
+		//! \brief Discards all the schema files cached by the parser forcing them to be read again on the next use
+		static void clearCache(void);
+
 		//! \brief Resets the parser in order to do new analysis
 		void restartParser(void);
 
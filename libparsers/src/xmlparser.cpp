@@ -25,11 +25,18 @@ const QString XMLParser::CHAR_GT=QString("&gt;");
 const QString XMLParser::CHAR_QUOT=QString("&quot;");
 const QString XMLParser::CHAR_APOS=QString("&apos;");
 
+map<QString, xmlDtd *> XMLParser::cached_dtds;
+QMutex XMLParser::dtd_mutex;
+bool XMLParser::trusted_input=false;
+
 XMLParser::XMLParser(void)
 {
 	root_elem=nullptr;
 	curr_elem=nullptr;
 	xml_doc=nullptr;
+	xml_reader=nullptr;
+	dtd=nullptr;
+	stream_header_pos=0;
 	xmlInitParser();
 }
 
@@ -123,34 +130,304 @@ void XMLParser::loadXMLBuffer(const QString &xml_buf)
 	}
 }
 
-void XMLParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
+void XMLParser::openXMLStream(const QString &filename)
 {
-	QString fmt_dtd_file;
+	QByteArray head;
+	xmlDtd *aux_dtd=dtd;
+	QString aux_dtd_name=dtd_name;
+	int pos1=-1, pos2=-1, tam=0, root_pos=-1, scan_pos=0, parser_opt;
+
+	if(filename.isEmpty())
+		throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	restartParser();
+	dtd=aux_dtd;
+	dtd_name=aux_dtd_name;
+
+	stream_file.setFileName(filename);
+	stream_file.open(QFile::ReadOnly);
+
+	if(!stream_file.isOpen())
+		throw Exception(QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(filename),
+										ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	/* Reading the beginning of the file until the start of the root element is found.
+	The portion before it (prolog) has the xml and dtd declarations replaced the same way
+	it's done in loadXMLBuffer() while the rest of the file is handed to the reader as is */
+	while(root_pos < 0 && !stream_file.atEnd())
+	{
+		head+=stream_file.read(4096);
+
+		for(; root_pos < 0 && scan_pos < head.size() - 1; scan_pos++)
+		{
+			if(head.at(scan_pos)=='<' &&
+				 (QChar::fromLatin1(head.at(scan_pos + 1)).isLetter() || head.at(scan_pos + 1)=='_'))
+				root_pos=scan_pos;
+		}
+	}
+
+	if(root_pos < 0)
+	{
+		restartParser();
+		throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	xml_buffer=QString::fromUtf8(head.left(root_pos));
+	pos1=xml_buffer.indexOf(QLatin1String("<?xml"));
+	pos2=xml_buffer.indexOf(QLatin1String("?>"));
+
+	if(pos1 >= 0 && pos2 >= 0)
+	{
+		tam=(pos2-pos1)+3;
+		xml_decl=xml_buffer.mid(pos1, tam);
+		xml_buffer.replace(pos1,tam,QString());
+	}
+	else
+		xml_decl=QString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+
+	removeDTD();
+
+	/* The document is not validated by the reader itself since it would need to load the DTD again.
+	Instead, each element read is validated against the cached DTD (see accessNextStreamElement()) */
+	parser_opt=( XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_NOENT );
+
+	stream_header.append(xml_decl);
+	stream_header.append(xml_buffer);
+	stream_header.append(head.mid(root_pos));
+	stream_header_pos=0;
+	xml_doc_filename=filename;
+
+	xmlResetLastError();
+	xml_reader=xmlReaderForIO(&XMLParser::readStream, nullptr, this, nullptr, nullptr, parser_opt);
+
+	if(!xml_reader)
+	{
+		restartParser();
+		throw Exception(QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(filename),
+										ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	//Moving the reader to the root element
+	while(xmlTextReaderRead(xml_reader)==1 &&
+				xmlTextReaderNodeType(xml_reader)!=XML_READER_TYPE_ELEMENT);
+
+	if(xmlGetLastError())
+		raiseParserError(xmlGetLastError());
+
+	if(xmlTextReaderNodeType(xml_reader)!=XML_READER_TYPE_ELEMENT)
+	{
+		restartParser();
+		throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	root_elem=curr_elem=xmlTextReaderCurrentNode(xml_reader);
+
+	if(!isValidationNeeded(root_elem))
+		dtd=nullptr;
+	else if(dtd)
+		checkRootElement(root_elem);
+}
 
+bool XMLParser::accessNextStreamElement(void)
+{
+	int ret=0;
+	xmlNode *elem=nullptr;
+
+	if(!xml_reader)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	//The previous element will be released by the reader so any reference to it is discarded
+	root_elem=curr_elem=nullptr;
+
+	while(!elems_stack.empty())
+		elems_stack.pop();
+
+	//Entering the root element in the first call or skipping the previous element read
+	if(xmlTextReaderDepth(xml_reader)==0 && xmlTextReaderNodeType(xml_reader)==XML_READER_TYPE_ELEMENT)
+		ret=(xmlTextReaderIsEmptyElement(xml_reader)==1 ? 0 : xmlTextReaderRead(xml_reader));
+	else if(xmlTextReaderDepth(xml_reader)==1)
+		ret=xmlTextReaderNext(xml_reader);
+
+	//Ignoring anything that isn't an element until the end of the root element is reached
+	while(ret==1 && xmlTextReaderDepth(xml_reader)==1 &&
+				xmlTextReaderNodeType(xml_reader)!=XML_READER_TYPE_ELEMENT)
+		ret=xmlTextReaderNext(xml_reader);
+
+	if(xmlGetLastError())
+		raiseParserError(xmlGetLastError());
+
+	if(ret!=1 || xmlTextReaderDepth(xml_reader)!=1)
+		return(false);
+
+	//Reading the whole element (and its children) so it can be navigated as a regular element tree
+	elem=xmlTextReaderExpand(xml_reader);
+
+	if(xmlGetLastError())
+		raiseParserError(xmlGetLastError());
+
+	if(!elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(dtd)
+		validateDocument(xmlTextReaderCurrentDoc(xml_reader), elem);
+
+	root_elem=curr_elem=elem;
+	return(true);
+}
+
+bool XMLParser::isStreaming(void)
+{
+	return(xml_reader!=nullptr);
+}
+
+int XMLParser::readStream(void *parser, char *buffer, int len)
+{
+	XMLParser *xmlparser=reinterpret_cast<XMLParser *>(parser);
+	int count=0;
+
+	//Handing the stream header first and then the rest of the file
+	if(xmlparser->stream_header_pos < xmlparser->stream_header.size())
+	{
+		count=std::min(len, xmlparser->stream_header.size() - xmlparser->stream_header_pos);
+		memcpy(buffer, xmlparser->stream_header.constData() + xmlparser->stream_header_pos, count);
+		xmlparser->stream_header_pos+=count;
+		return(count);
+	}
+
+	return(static_cast<int>(xmlparser->stream_file.read(buffer, len)));
+}
+
+void XMLParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
+{
 	if(dtd_file.isEmpty())
 		throw Exception(ERR_ASG_EMPTY_DTD_FILE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	if(dtd_name.isEmpty())
 		throw Exception(ERR_ASG_EMPTY_DTD_NAME,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-#ifndef Q_OS_WIN
-	fmt_dtd_file=QString("file://");
-#else
-	fmt_dtd_file=QString("file:///");
-#endif
+	dtd=getCachedDTD(dtd_file);
+	this->dtd_name=dtd_name;
+}
+
+xmlDtd *XMLParser::getCachedDTD(const QString &dtd_file)
+{
+	QMutexLocker locker(&dtd_mutex);
+	QString abs_path=QFileInfo(dtd_file).absoluteFilePath();
+	QByteArray fmt_dtd_file;
+	xmlDtd *parsed_dtd=nullptr;
+	xmlError *xml_error=nullptr;
+
+	if(cached_dtds.count(abs_path))
+		return(cached_dtds[abs_path]);
 
 	//Formats the dtd file path to URL style (converting to percentage format the non reserved chars)
-	fmt_dtd_file=QUrl::toPercentEncoding(QFileInfo(dtd_file).absoluteFilePath(), "/:");
-	dtd_decl=QString("<!DOCTYPE ") + dtd_name +
-			 QString(" SYSTEM ") +
-			 QString("\"") +
-			 fmt_dtd_file + QString("\">\n");
+	fmt_dtd_file=QUrl::toPercentEncoding(abs_path, "/:");
+
+	xmlResetLastError();
+	parsed_dtd=xmlParseDTD(nullptr, reinterpret_cast<const xmlChar *>(fmt_dtd_file.constData()));
+	xml_error=xmlGetLastError();
+
+	if(!parsed_dtd)
+	{
+		QString msg=(xml_error ? QString(xml_error->message).replace("\n"," ") : QString());
+
+		throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+										.arg(xml_error ? xml_error->line : 0).arg(xml_error ? xml_error->int2 : 0)
+										.arg(msg).arg(QString("(%1)").arg(abs_path)),
+										ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	cached_dtds[abs_path]=parsed_dtd;
+	return(parsed_dtd);
+}
+
+void XMLParser::clearDTDCache(void)
+{
+	QMutexLocker locker(&dtd_mutex);
+
+	for(auto &itr : cached_dtds)
+		xmlFreeDtd(itr.second);
+
+	cached_dtds.clear();
+}
+
+void XMLParser::setTrustedInputMode(bool value)
+{
+	trusted_input=value;
+}
+
+bool XMLParser::isTrustedInputMode(void)
+{
+	return(trusted_input);
+}
+
+bool XMLParser::isValidationNeeded(xmlNode *root)
+{
+	if(!trusted_input)
+		return(true);
+
+	//Buffers are always generated by pgModeler itself
+	if(xml_doc_filename.isEmpty())
+		return(false);
+
+	return(!root || !xmlHasProp(root, reinterpret_cast<const xmlChar *>(ParsersAttributes::PGMODELER_VERSION.toStdString().c_str())));
+}
+
+void XMLParser::checkRootElement(xmlNode *root)
+{
+	if(!root || QString(reinterpret_cast<const char *>(root->name))!=dtd_name)
+	{
+		int line=(root ? root->line : 0);
+		QString name=dtd_name;
+
+		restartParser();
+		throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+										.arg(line).arg(0).arg(QString("Root element does not match the DTD name `%1'").arg(name)).arg(QString()),
+										ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
+
+void XMLParser::validateDocument(xmlDoc *doc, xmlNode *elem)
+{
+	QMutexLocker locker(&dtd_mutex);
+	xmlValidCtxt *valid_ctxt=nullptr;
+	xmlDtd *ext_subset=nullptr;
+	int valid=0;
+
+	if(!dtd || !doc)
+		return;
+
+	xmlResetLastError();
+	valid_ctxt=xmlNewValidCtxt();
+
+	if(!elem)
+		valid=xmlValidateDtd(valid_ctxt, doc, dtd);
+	else
+	{
+		//Temporarily assigning the cached DTD to the document so the element can be validated
+		ext_subset=doc->extSubset;
+		doc->extSubset=dtd;
+		valid=xmlValidateElement(valid_ctxt, doc, elem);
+		doc->extSubset=ext_subset;
+	}
+
+	xmlFreeValidCtxt(valid_ctxt);
+	locker.unlock();
+
+	if(!valid)
+	{
+		if(xmlGetLastError())
+			raiseParserError(xmlGetLastError());
+
+		restartParser();
+		throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR)).arg(0).arg(0).arg(QString()).arg(QString()),
+										ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
 }
 
 void XMLParser::readBuffer(void)
 {
 	QByteArray buffer;
-	QString msg, file;
 	xmlError *xml_error=nullptr;
 	int parser_opt;
 
@@ -159,19 +436,10 @@ void XMLParser::readBuffer(void)
 		//Inserts the XML declaration
 		buffer+=xml_decl;
 
-		//Configures the parser, initially, to not validate the document against the dtd
+		/* Configures the parser to not validate the document while reading it. The validation is made afterwards
+		against the cached DTD avoiding to read and parse the DTD files for each document */
 		parser_opt=( XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_NOENT );
 
-		//If the dtd declarions is setup
-		if(!dtd_decl.isEmpty())
-		{
-			//Inserts the default software DTD declarion into XML buffer
-			buffer+=dtd_decl;
-
-			//Now configures the parser to validate the buffer against the DTD
-			parser_opt=(parser_opt | XML_PARSE_DTDLOAD | XML_PARSE_DTDVALID);
-		}
-
 		buffer+=xml_buffer;
 
 		//Create an xml document from the buffer
@@ -182,27 +450,39 @@ void XMLParser::readBuffer(void)
 
 		//If some error is set
 		if(xml_error)
-		{
-			//Formats the error
-			msg=xml_error->message;
-			file=xml_error->file;
-			if(!file.isEmpty()) file=QString("(%1)").arg(file);
-			msg.replace("\n"," ");
-
-			//Restarts the parser
-			if(xml_doc) restartParser();
-
-			//Raise an exception with the error massege from the parser xml
-			throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
-							.arg(xml_error->line).arg(xml_error->int2).arg(msg).arg(file),
-							ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-		}
+			raiseParserError(xml_error);
 
 		//Gets the referênce to the root element on the document
 		root_elem=curr_elem=xmlDocGetRootElement(xml_doc);
+
+		if(dtd && isValidationNeeded(root_elem))
+		{
+			checkRootElement(root_elem);
+			validateDocument(xml_doc, nullptr);
+		}
 	}
 }
 
+void XMLParser::raiseParserError(xmlError *xml_error)
+{
+	QString msg, file;
+	int line=xml_error->line, column=xml_error->int2;
+
+	//Formats the error
+	msg=xml_error->message;
+	file=xml_error->file;
+	if(!file.isEmpty()) file=QString("(%1)").arg(file);
+	msg.replace("\n"," ");
+
+	//Restarts the parser
+	if(xml_doc || xml_reader) restartParser();
+
+	//Raise an exception with the error massege from the parser xml
+	throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+					.arg(line).arg(column).arg(msg).arg(file),
+					ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+}
+
 void XMLParser::savePosition(void)
 {
 	if(!root_elem)
@@ -229,7 +509,7 @@ void XMLParser::restorePosition(const xmlNode *elem)
 {
 	if(!elem)
 		throw Exception(ERR_OPR_NOT_ALOC_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-	else if(elem->doc!=xml_doc)
+	else if(elem->doc!=(xml_reader ? xmlTextReaderCurrentDoc(xml_reader) : xml_doc))
 		throw Exception(ERR_OPR_INEXIST_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	restartNavigation();
@@ -256,7 +536,20 @@ void XMLParser::restartParser(void)
 		xmlFreeDoc(xml_doc);
 		xml_doc=nullptr;
 	}
-	dtd_decl=xml_buffer=xml_decl=QString();
+
+	if(xml_reader)
+	{
+		xmlFreeTextReader(xml_reader);
+		xml_reader=nullptr;
+	}
+
+	if(stream_file.isOpen())
+		stream_file.close();
+
+	stream_header.clear();
+	stream_header_pos=0;
+	dtd=nullptr;
+	dtd_name=xml_buffer=xml_decl=QString();
 
 	while(!elems_stack.empty())
 		elems_stack.pop();
@@ -417,3 +710,12 @@ int XMLParser::getBufferLineCount(void)
 		return(0);
 }
 
+int XMLParser::getReadingProgress(void)
+{
+	if(xml_reader && stream_file.size() > 0)
+		return((stream_file.pos()/static_cast<double>(stream_file.size())) * 100);
+	else if(getBufferLineCount() > 0)
+		return((getCurrentBufferLine()/static_cast<double>(getBufferLineCount())) * 100);
+	else
+		return(0);
+}
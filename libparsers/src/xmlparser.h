@@ -28,8 +28,12 @@
 
 #include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <libxml/xmlreader.h>
 #include "schemaparser.h"
+#include "parsersattributes.h"
 #include "exception.h"
+#include <QFile>
+#include <QMutex>
 #include <stack>
 #include <iostream>
 #include "attribsmap.h"
@@ -48,14 +52,40 @@ class XMLParser {
 		//! \brief Stores the current element that parser is analyzing
 		*curr_elem;
 
+		/*! \brief Stores the reader used when the parser works in streaming mode (see openXMLStream()).
+		In this mode only the element being processed (and its children) is kept in memory */
+		xmlTextReader *xml_reader;
+
+		//! \brief File being read in streaming mode
+		QFile stream_file;
+
+		/*! \brief Stores the beginning of the document read in streaming mode (xml declaration, dtd declaration
+		and the starting of the root element) which is handed to the reader before the rest of the file */
+		QByteArray stream_header;
+
+		//! \brief Number of bytes of the stream header already handed to the reader
+		int stream_header_pos;
+
 		/*! \brief Stores the elements that marks the position in the tree before do
 		 a subsequent operation. To configure this element it is necessary
 		 call the method savePosition() and to return the navigation to the saved
 		 position is necessary call restorePosition() */
 		stack<xmlNode *> elems_stack;
 
-		//! \brief Stores the document DTD declaration
-		QString	dtd_decl,
+		//! \brief Stores the pre-parsed DTDs shared by all parser instances. The key is the DTD's absolute path
+		static map<QString, xmlDtd *> cached_dtds;
+
+		//! \brief Synchronizes the access to the cached DTDs (including the validations made with them)
+		static QMutex dtd_mutex;
+
+		//! \brief Indicates if the documents written by pgModeler itself are trusted (see setTrustedInputMode())
+		static bool trusted_input;
+
+		//! \brief Stores the DTD (owned by the cache) used to validate the document
+		xmlDtd *dtd;
+
+		//! \brief Stores the name of the root element expected by the DTD
+		QString	dtd_name,
 		//! \brief Stores XML document to be analyzed
 		xml_buffer,
 		/*! \brief Stores the declaration <?xml?>. If this isn't exists it will be
@@ -72,6 +102,26 @@ class XMLParser {
 		 generated from the XML document read. */
 		void readBuffer(void);
 
+		//! \brief Raises an exception containing the details of the error generated by libxml2
+		void raiseParserError(xmlError *xml_error);
+
+		//! \brief Returns the pre-parsed DTD of the file, parsing and storing it in the cache in the first call
+		static xmlDtd *getCachedDTD(const QString &dtd_file);
+
+		/*! \brief Returns if the document, which root element is passed, needs to be validated against the DTD.
+		In trusted input mode the buffers generated in memory and the files written by pgModeler aren't validated */
+		bool isValidationNeeded(xmlNode *root);
+
+		//! \brief Raises an error if the root element of the document is not the one expected by the DTD
+		void checkRootElement(xmlNode *root);
+
+		/*! \brief Validates the whole document against the configured DTD or, when 'elem' is specified,
+		only that element and its children (used in streaming mode) */
+		void validateDocument(xmlDoc *doc, xmlNode *elem);
+
+		//! \brief Callback used by the reader in streaming mode to get the next portion of the document
+		static int readStream(void *parser, char *buffer, int len);
+
 	public:
 		//! \brief Constants used to referência the elements on the element tree
 		static const unsigned ROOT_ELEMENT=0,
@@ -94,9 +144,35 @@ class XMLParser {
 		//! \brief Loads the XML buffer from a string
 		void loadXMLBuffer(const QString &xml_buf);
 
-		//! \brief Informs the DTD file used to make element validations
+		/*! \brief Opens a XML file in streaming mode. Differently from loadXMLFile() the document isn't
+		read at once, instead, the parser is positioned at the root element (only its attributes are available)
+		and each child of the root is read on demand by calling accessNextStreamElement(). The DTD file,
+		when needed, must be configured prior calling this method */
+		void openXMLStream(const QString &filename);
+
+		/*! \brief Reads the next child element of the root element in streaming mode. The element read becomes the
+		root of the element tree so the navigation methods can be used normally. The previous element read is
+		released, so any reference to it (or to its children) will be invalid. Returns false when there're no more elements */
+		bool accessNextStreamElement(void);
+
+		//! \brief Returns if the parser is working in streaming mode
+		bool isStreaming(void);
+
+		/*! \brief Informs the DTD file used to make element validations. The DTD is parsed only once
+		and shared between all parser instances */
 		void setDTDFile(const QString &dtd_file, const QString &dtd_name);
 
+		/*! \brief Toggles the trusted input mode for all parsers. In this mode the validation against the DTD is skipped
+		for buffers generated in memory and for files written by pgModeler itself (the ones which root element carries
+		the pgModeler version). Other files are still validated. This mode is disabled by default */
+		static void setTrustedInputMode(bool value);
+
+		//! \brief Returns if the trusted input mode is enabled
+		static bool isTrustedInputMode(void);
+
+		//! \brief Releases all the cached DTDs. This must not be called while a parser is using a DTD
+		static void clearDTDCache(void);
+
 		//! \brief Saves to stack the current navigation position on the element tree
 		void savePosition(void);
 
@@ -138,6 +214,10 @@ class XMLParser {
 		//! \brief Returns the total line amount of the buffer
 		int getBufferLineCount(void);
 
+		/*! \brief Returns the percentage of the document already read. In streaming mode this is
+		based upon the amount of bytes read from file otherwise the current line is used */
+		int getReadingProgress(void);
+
 		//! \brief Returns the tag name that defines the current element
 		QString getElementName(void);
 
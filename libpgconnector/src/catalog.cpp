@@ -28,6 +28,29 @@ const QString Catalog::GET_EXT_OBJS_SQL=QString("SELECT objid AS oid FROM pg_dep
 
 bool Catalog::use_cached_queries=false;
 attribs_map Catalog::catalog_queries;
+QMutex Catalog::queries_mutex;
+map<QString, map<QString, vector<attribs_map>>> Catalog::metadata_cache;
+map<QString, QString> Catalog::cache_stamps;
+QMutex Catalog::cache_mutex;
+
+const QString Catalog::CHANGE_STAMP_SQL=QString("(SELECT count(*) || ':' || coalesce(max(xmin::text::bigint), 0) FROM pg_catalog.%1)");
+
+/* Catalogs handled by CHANGE_STAMP_SQL and the PostgreSQL version from which they exist.
+Roles are handled apart since pg_authid can't be read by ordinary users (see getChangeStampQuery()) */
+map<QString, QString> Catalog::stamp_catalogs=
+{ {"pg_namespace", ""}, {"pg_class", ""}, {"pg_attribute", ""}, {"pg_attrdef", ""},
+	{"pg_index", ""}, {"pg_inherits", ""}, {"pg_proc", ""}, {"pg_aggregate", ""},
+	{"pg_type", ""}, {"pg_enum", ""}, {"pg_constraint", ""}, {"pg_trigger", ""},
+	{"pg_rewrite", ""}, {"pg_description", ""}, {"pg_shdescription", ""}, {"pg_depend", ""},
+	{"pg_operator", ""}, {"pg_opclass", ""}, {"pg_opfamily", ""}, {"pg_amop", ""},
+	{"pg_amproc", ""}, {"pg_cast", ""}, {"pg_language", ""}, {"pg_conversion", ""},
+	{"pg_tablespace", ""}, {"pg_database", ""}, {"pg_auth_members", ""}, {"pg_default_acl", ""},
+	{"pg_foreign_data_wrapper", ""}, {"pg_foreign_server", ""}, {"pg_ts_config", ""}, {"pg_ts_dict", ""},
+	{"pg_ts_parser", ""}, {"pg_ts_template", ""}, {"pg_extension", PgSQLVersions::PGSQL_VERSION_91},
+	{"pg_collation", PgSQLVersions::PGSQL_VERSION_91}, {"pg_foreign_table", PgSQLVersions::PGSQL_VERSION_91},
+	{"pg_range", PgSQLVersions::PGSQL_VERSION_92}, {"pg_event_trigger", PgSQLVersions::PGSQL_VERSION_93},
+	{"pg_policy", PgSQLVersions::PGSQL_VERSION_95}
+};
 
 map<ObjectType, QString> Catalog::oid_fields=
 { {OBJ_DATABASE, "oid"}, {OBJ_ROLE, "oid"}, {OBJ_SCHEMA,"oid"},
@@ -51,6 +74,7 @@ map<ObjectType, QString> Catalog::ext_oid_fields={
 Catalog::Catalog(void)
 {
 	last_sys_oid=0;
+	use_metadata_cache=false;
 	setFilter(EXCL_EXTENSION_OBJS | EXCL_SYSTEM_OBJS);
 }
 
@@ -63,35 +87,61 @@ void Catalog::setConnection(Connection &conn)
 {
 	try
 	{
-		ResultSet res;
-		QStringList ext_obj;
-
 		connection.close();
 		connection.setConnectionParams(conn.getConnectionParams());
 		connection.connect();
+		reloadCatalogInfo();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
 
-		//Retrieving the last system oid
-		executeCatalogQuery(QUERY_LIST, OBJ_DATABASE, res, true,
-		{{ParsersAttributes::NAME, conn.getConnectionParam(Connection::PARAM_DB_NAME)}});
+void Catalog::reloadCatalogInfo(void)
+{
+	try
+	{
+		ResultSet res;
+		QStringList ext_obj;
+		vector<attribs_map> tuples;
+		attribs_map db_attribs={{ParsersAttributes::NAME, connection.getConnectionParam(Connection::PARAM_DB_NAME)}};
+		QString db_key=getCacheKey(QUERY_LIST, OBJ_DATABASE, true, db_attribs),
+				ext_key=GET_EXT_OBJS_SQL;
 
-		if(res.accessTuple(ResultSet::FIRST_TUPLE))
+		//Retrieving the last system oid
+		if(!getCachedResult(db_key, tuples))
 		{
-			attribs_map attribs=changeAttributeNames(res.getTupleValues());
-			last_sys_oid=attribs[ParsersAttributes::LAST_SYS_OID].toUInt();
+			executeCatalogQuery(QUERY_LIST, OBJ_DATABASE, res, true, db_attribs);
+
+			if(res.accessTuple(ResultSet::FIRST_TUPLE))
+				getResultAttributes(res, tuples, BASE_OBJECT, true);
+
+			storeCachedResult(db_key, tuples);
 		}
 
+		last_sys_oid=0;
+
+		if(!tuples.empty())
+			last_sys_oid=tuples[0][ParsersAttributes::LAST_SYS_OID].toUInt();
+
 		//Retrieving the list of objects created by extensions
-		this->connection.executeDMLCommand(GET_EXT_OBJS_SQL, res);
-		if(res.accessTuple(ResultSet::FIRST_TUPLE))
+		tuples.clear();
+
+		if(!getCachedResult(ext_key, tuples))
 		{
-			do
-			{
-				ext_obj.push_back(res.getColumnValue(QString("oid")));
-			}
-			while(res.accessTuple(ResultSet::NEXT_TUPLE));
+			this->connection.executeDMLCommand(GET_EXT_OBJS_SQL, res);
 
-			ext_obj_oids=ext_obj.join(',');
+			if(res.accessTuple(ResultSet::FIRST_TUPLE))
+				getResultAttributes(res, tuples);
+
+			storeCachedResult(ext_key, tuples);
 		}
+
+		for(auto &tuple : tuples)
+			ext_obj.push_back(tuple[QString("oid")]);
+
+		ext_obj_oids=ext_obj.join(',');
 	}
 	catch(Exception &e)
 	{
@@ -104,6 +154,16 @@ void Catalog::closeConnection(void)
 	connection.close();
 }
 
+bool Catalog::isConnectionStablished(void)
+{
+	return(connection.isAlive());
+}
+
+QString Catalog::getConnectionId(void)
+{
+	return(connection.getConnectionId(true, true));
+}
+
 void Catalog::setFilter(unsigned filter)
 {
 	bool list_all=(LIST_ALL_OBJS & filter) == LIST_ALL_OBJS;
@@ -126,6 +186,56 @@ void Catalog::setFilter(unsigned filter)
 	}
 }
 
+QString Catalog::exportSnapshot(void)
+{
+	try
+	{
+		ResultSet res;
+		QString snapshot_id;
+
+		//Snapshot exporting is available only from PostgreSQL 9.2 on
+		if(connection.getPgSQLVersion(true).toFloat() < PgSQLVersions::PGSQL_VERSION_92.toFloat())
+			return(QString());
+
+		connection.executeDDLCommand(QString("BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ"));
+		connection.executeDMLCommand(QString("SELECT pg_export_snapshot() AS snapshot"), res);
+
+		if(res.accessTuple(ResultSet::FIRST_TUPLE))
+			snapshot_id=res.getColumnValue(QString("snapshot"));
+
+		return(snapshot_id);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void Catalog::importSnapshot(const QString &snapshot_id)
+{
+	try
+	{
+		connection.executeDDLCommand(QString("BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ"));
+		connection.executeDDLCommand(QString("SET TRANSACTION SNAPSHOT '%1'").arg(snapshot_id));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void Catalog::releaseSnapshot(void)
+{
+	try
+	{
+		connection.executeDDLCommand(QString("COMMIT"));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 unsigned Catalog::getLastSysObjectOID(void)
 {
 	return(last_sys_oid);
@@ -138,6 +248,9 @@ bool Catalog::isExtensionObject(unsigned oid)
 
 void Catalog::loadCatalogQuery(const QString &qry_id)
 {
+	QMutexLocker locker(&queries_mutex);
+	QString query;
+
 	if((!use_cached_queries) ||
 			(use_cached_queries && catalog_queries.count(qry_id)==0))
 	{
@@ -154,7 +267,10 @@ void Catalog::loadCatalogQuery(const QString &qry_id)
 		input.close();
 	}
 
-	schparser.loadBuffer(catalog_queries[qry_id]);
+	query=catalog_queries[qry_id];
+	locker.unlock();
+
+	schparser.loadBuffer(query);
 }
 
 QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result, attribs_map attribs)
@@ -310,20 +426,26 @@ attribs_map Catalog::getObjectsNames(ObjectType obj_type, const QString &sch_nam
 	{
 		ResultSet res;
 		attribs_map objects;
+		vector<attribs_map> tuples;
+		QString key;
 
 		extra_attribs[ParsersAttributes::SCHEMA]=sch_name;
 		extra_attribs[ParsersAttributes::TABLE]=tab_name;
-		executeCatalogQuery(QUERY_LIST, obj_type, res, false, extra_attribs);
+		key=getCacheKey(QUERY_LIST, obj_type, false, extra_attribs);
 
-		if(res.accessTuple(ResultSet::FIRST_TUPLE))
+		if(!getCachedResult(key, tuples))
 		{
-			do
-			{
-				objects[res.getColumnValue(ParsersAttributes::OID)]=res.getColumnValue(ParsersAttributes::NAME);
-			}
-			while(res.accessTuple(ResultSet::NEXT_TUPLE));
+			executeCatalogQuery(QUERY_LIST, obj_type, res, false, extra_attribs);
+
+			if(res.accessTuple(ResultSet::FIRST_TUPLE))
+				getResultAttributes(res, tuples);
+
+			storeCachedResult(key, tuples);
 		}
 
+		for(auto &tuple : tuples)
+			objects[tuple[ParsersAttributes::OID]]=tuple[ParsersAttributes::NAME];
+
 		return(objects);
 	}
 	catch(Exception &e)
@@ -338,13 +460,19 @@ vector<attribs_map> Catalog::getObjectsNames(vector<ObjectType> obj_types, const
 	{
 		ResultSet res;
 		vector<attribs_map> objects;
-		QString sql, select_kw=QString("SELECT");
+		QString sql, select_kw=QString("SELECT"), key;
 		QStringList queries;
-		attribs_map attribs;
 
 		extra_attribs[ParsersAttributes::SCHEMA]=sch_name;
 		extra_attribs[ParsersAttributes::TABLE]=tab_name;
 
+		//The key is composed by the keys of each object type's query and the sorting option
+		for(ObjectType obj_type : obj_types)
+			key+=getCacheKey(QUERY_LIST, obj_type, sort_results, extra_attribs);
+
+		if(getCachedResult(key, objects))
+			return(objects);
+
 		for(ObjectType obj_type : obj_types)
 		{
 			//Build the catalog query for the specified object type
@@ -374,17 +502,23 @@ vector<attribs_map> Catalog::getObjectsNames(vector<ObjectType> obj_types, const
 
 		if(res.accessTuple(ResultSet::FIRST_TUPLE))
 		{
+			//Resolving the columns indexes only once for the whole result
+			int oid_col=res.getColumnIndex(ParsersAttributes::OID),
+					name_col=res.getColumnIndex(ParsersAttributes::NAME),
+					type_col=res.getColumnIndex(QString("object_type"));
+
+			objects.reserve(res.getTupleCount());
+
 			do
 			{
-				attribs[ParsersAttributes::OID]=res.getColumnValue(ParsersAttributes::OID);
-				attribs[ParsersAttributes::NAME]=res.getColumnValue(ParsersAttributes::NAME);
-				attribs[ParsersAttributes::OBJECT_TYPE]=res.getColumnValue(QString("object_type"));
-				objects.push_back(attribs);
-				attribs.clear();
+				objects.push_back({{ ParsersAttributes::OID, res.getColumnData(oid_col) },
+													 { ParsersAttributes::NAME, QString::fromUtf8(res.getColumnData(name_col)) },
+													 { ParsersAttributes::OBJECT_TYPE, res.getColumnData(type_col) }});
 			}
 			while(res.accessTuple(ResultSet::NEXT_TUPLE));
 		}
 
+		storeCachedResult(key, objects);
 		return(objects);
 	}
 	catch(Exception &e)
@@ -398,20 +532,28 @@ attribs_map Catalog::getAttributes(const QString &obj_name, ObjectType obj_type,
 	try
 	{
 		ResultSet res;
-		attribs_map obj_attribs;
+		vector<attribs_map> obj_attribs;
+		QString key;
 
 		//Add the name of the object as extra attrib in order to retrieve the data only for it
 		extra_attribs[ParsersAttributes::NAME]=obj_name;
-		executeCatalogQuery(QUERY_ATTRIBS, obj_type, res, true, extra_attribs);
+		key=getCacheKey(QUERY_ATTRIBS, obj_type, true, extra_attribs);
 
-		if(res.accessTuple(ResultSet::FIRST_TUPLE))
-			obj_attribs=changeAttributeNames(res.getTupleValues());
+		if(!getCachedResult(key, obj_attribs))
+		{
+			executeCatalogQuery(QUERY_ATTRIBS, obj_type, res, true, extra_attribs);
 
-		/* Insert the object type as an attribute of the query result to facilitate the
-		import process on the classes that uses the Catalog */
-		obj_attribs[ParsersAttributes::OBJECT_TYPE]=QString("%1").arg(obj_type);
+			/* Insert the object type as an attribute of the query result to facilitate the
+			import process on the classes that uses the Catalog */
+			if(res.accessTuple(ResultSet::FIRST_TUPLE))
+				getResultAttributes(res, obj_attribs, obj_type, true);
+			else
+				obj_attribs.push_back({{ ParsersAttributes::OBJECT_TYPE, QString("%1").arg(obj_type) }});
 
-		return(obj_attribs);
+			storeCachedResult(key, obj_attribs);
+		}
+
+		return(std::move(obj_attribs[0]));
 	}
 	catch(Exception &e)
 	{
@@ -424,26 +566,20 @@ vector<attribs_map> Catalog::getMultipleAttributes(ObjectType obj_type, attribs_
 	try
 	{
 		ResultSet res;
-		attribs_map tuple;
 		vector<attribs_map> obj_attribs;
+		QString key=getCacheKey(QUERY_ATTRIBS, obj_type, false, extra_attribs);
 
-		executeCatalogQuery(QUERY_ATTRIBS, obj_type, res, false, extra_attribs);
-		if(res.accessTuple(ResultSet::FIRST_TUPLE))
-		{
-			do
-			{
-				tuple=changeAttributeNames(res.getTupleValues());
+		if(getCachedResult(key, obj_attribs))
+			return(obj_attribs);
 
-				/* Insert the object type as an attribute of the query result to facilitate the
-				import process on the classes that uses the Catalog */
-				tuple[ParsersAttributes::OBJECT_TYPE]=QString("%1").arg(obj_type);
+		executeCatalogQuery(QUERY_ATTRIBS, obj_type, res, false, extra_attribs);
 
-				obj_attribs.push_back(tuple);
-				tuple.clear();
-			}
-			while(res.accessTuple(ResultSet::NEXT_TUPLE));
-		}
+		/* Insert the object type as an attribute of the query result to facilitate the
+		import process on the classes that uses the Catalog */
+		if(res.accessTuple(ResultSet::FIRST_TUPLE))
+			getResultAttributes(res, obj_attribs, obj_type);
 
+		storeCachedResult(key, obj_attribs);
 		return(obj_attribs);
 	}
 	catch(Exception &e)
@@ -491,30 +627,78 @@ QString Catalog::getNotExtObjectQuery(const QString &oid_field)
 	}
 }
 
-attribs_map Catalog::changeAttributeNames(const attribs_map &attribs)
+QString Catalog::changeAttributeName(const QString &col_name, bool &is_bool)
 {
-	attribs_map::const_iterator itr=attribs.begin();
-	attribs_map new_attribs;
-	QString attr_name, value;
+	QString attr_name=col_name;
 
-	while(itr!=attribs.end())
-	{
-		attr_name=itr->first;
-		value=itr->second;
+	is_bool=attr_name.endsWith(BOOL_FIELD);
+
+	if(is_bool)
+		attr_name.remove(BOOL_FIELD);
 
-		if(attr_name.endsWith(BOOL_FIELD))
+	attr_name.replace('_','-');
+	return(attr_name);
+}
+
+void Catalog::getResultAttributes(ResultSet &res, vector<attribs_map> &tuples, ObjectType obj_type, bool single_tuple)
+{
+	try
+	{
+		QStringList col_names=res.getColumnNames();
+		int col_cnt=col_names.size();
+		vector<QString> attr_names(col_cnt);
+		vector<bool> bool_cols(col_cnt);
+		vector<int> cols;
+		QByteArray value, pgsql_false=PGSQL_FALSE.toLatin1();
+		QString obj_type_str;
+		bool is_bool=false;
+
+		//Resolving the attribute names only once for the whole result
+		for(int col=0; col < col_cnt; col++)
 		{
-			attr_name.remove(BOOL_FIELD);
-			if(value==PGSQL_FALSE) value.clear();
-			else value=ParsersAttributes::_TRUE_;
+			attr_names[col]=changeAttributeName(col_names[col], is_bool);
+			bool_cols[col]=is_bool;
+			cols.push_back(col);
 		}
 
-		attr_name.replace('_','-');
-		new_attribs[attr_name]=value;
-		itr++;
-	}
+		/* Visiting the columns in the attribute names order so the maps can be filled
+		by appending each attribute at the end (no search on the map is needed) */
+		std::stable_sort(cols.begin(), cols.end(), [&attr_names](int col1, int col2){
+			return(attr_names[col1] < attr_names[col2]);
+		});
+
+		if(obj_type!=BASE_OBJECT)
+			obj_type_str=QString("%1").arg(obj_type);
+
+		if(!single_tuple)
+			tuples.reserve(tuples.size() + res.getTupleCount());
+
+		do
+		{
+			tuples.emplace_back();
+			attribs_map &tuple=tuples.back();
+
+			for(int col : cols)
+			{
+				value=res.getColumnData(col);
+
+				/* The attribute names are shared among all the maps (implicitly shared strings)
+				and only the values are converted from the result's memory */
+				if(bool_cols[col])
+					tuple.emplace_hint(tuple.end(), attr_names[col], (value==pgsql_false ? QString() : ParsersAttributes::_TRUE_));
+				else
+					tuple.emplace_hint(tuple.end(), attr_names[col], QString::fromUtf8(value.constData(), value.size()));
+			}
 
-	return(new_attribs);
+			if(!obj_type_str.isEmpty())
+				tuple[ParsersAttributes::OBJECT_TYPE]=obj_type_str;
+		}
+		while(!single_tuple && res.accessTuple(ResultSet::NEXT_TUPLE));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
 }
 
 QString Catalog::createOidFilter(const vector<unsigned> &oids)
@@ -530,6 +714,124 @@ QString Catalog::createOidFilter(const vector<unsigned> &oids)
 	return(filter);
 }
 
+QString Catalog::getCacheKey(const QString &qry_type, ObjectType obj_type, bool single_result, const attribs_map &attribs)
+{
+	/* The sequences attributes are read from the sequences themselves and not from the system catalogs
+	so changes on them can't be detected by validateMetadataCache(). Those results are never cached */
+	if(qry_type==QUERY_ATTRIBS && obj_type==OBJ_SEQUENCE)
+		return(QString());
+
+	QString key=QString("%1:%2:%3:%4").arg(qry_type).arg(obj_type).arg(single_result).arg(filter);
+
+	for(auto &attr : attribs)
+		key+=QString("\n%1=%2").arg(attr.first).arg(attr.second);
+
+	return(key + QChar('\n'));
+}
+
+bool Catalog::getCachedResult(const QString &key, vector<attribs_map> &tuples)
+{
+	if(!use_metadata_cache || key.isEmpty())
+		return(false);
+
+	QMutexLocker locker(&cache_mutex);
+	map<QString, vector<attribs_map>> &results=metadata_cache[getConnectionId()];
+	map<QString, vector<attribs_map>>::iterator itr=results.find(key);
+
+	if(itr==results.end())
+		return(false);
+
+	tuples=itr->second;
+	return(true);
+}
+
+void Catalog::storeCachedResult(const QString &key, const vector<attribs_map> &tuples)
+{
+	if(!use_metadata_cache || key.isEmpty())
+		return;
+
+	QMutexLocker locker(&cache_mutex);
+	metadata_cache[getConnectionId()][key]=tuples;
+}
+
+QString Catalog::getChangeStampQuery(void)
+{
+	QStringList stamps;
+	float pgsql_ver=connection.getPgSQLVersion(true).toFloat();
+
+	for(auto &itr : stamp_catalogs)
+	{
+		if(itr.second.isEmpty() || pgsql_ver >= itr.second.toFloat())
+			stamps.push_back(CHANGE_STAMP_SQL.arg(itr.first));
+	}
+
+	//The roles are checked through their public view by comparing a hash of all of its rows
+	stamps.push_back(QString("(SELECT md5(coalesce(string_agg(rl::text, ',' ORDER BY rl.oid), '')) FROM pg_catalog.pg_roles AS rl)"));
+
+	return(QString("SELECT ") + stamps.join(QString(" || ',' || ")) + QString(" AS stamp"));
+}
+
+bool Catalog::validateMetadataCache(void)
+{
+	try
+	{
+		ResultSet res;
+		QString stamp, conn_id=getConnectionId();
+		bool discarded=false;
+
+		connection.executeDMLCommand(getChangeStampQuery(), res);
+
+		if(res.accessTuple(ResultSet::FIRST_TUPLE))
+			stamp=res.getColumnValue(QString("stamp"));
+
+		{
+			QMutexLocker locker(&cache_mutex);
+			discarded=(cache_stamps[conn_id]!=stamp);
+
+			if(discarded)
+			{
+				metadata_cache.erase(conn_id);
+				cache_stamps[conn_id]=stamp;
+			}
+		}
+
+		if(discarded)
+			reloadCatalogInfo();
+
+		return(discarded);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void Catalog::enableMetadataCache(bool value)
+{
+	use_metadata_cache=value;
+}
+
+bool Catalog::isMetadataCacheEnabled(void)
+{
+	return(use_metadata_cache);
+}
+
+void Catalog::clearMetadataCache(const QString &conn_id)
+{
+	QMutexLocker locker(&cache_mutex);
+
+	if(conn_id.isEmpty())
+	{
+		metadata_cache.clear();
+		cache_stamps.clear();
+	}
+	else
+	{
+		metadata_cache.erase(conn_id);
+		cache_stamps.erase(conn_id);
+	}
+}
+
 vector<attribs_map> Catalog::getObjectsAttributes(ObjectType obj_type, const QString &schema, const QString &table, const vector<unsigned> &filter_oids, attribs_map extra_attribs)
 {
 	try
@@ -718,6 +1020,7 @@ void Catalog::operator = (const Catalog &catalog)
 		this->exclude_sys_objs=catalog.exclude_sys_objs;
 		this->exclude_array_types=catalog.exclude_array_types;
 		this->list_only_sys_objs=catalog.list_only_sys_objs;
+		this->use_metadata_cache=catalog.use_metadata_cache;
 		this->connection.connect();
 	}
 	catch(Exception &e)
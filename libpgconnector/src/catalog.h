@@ -31,6 +31,8 @@ This class is the basis for the reverse engineering feature.
 #include "tableobject.h"
 #include <QTextStream>
 #include <QApplication>
+#include <QMutex>
+#include <algorithm>
 
 class Catalog {
 	private:
@@ -68,6 +70,31 @@ class Catalog {
 		//! \brief Store the cached catalog queries (only when use_cached_queries=true)
 		static attribs_map catalog_queries;
 
+		//! \brief Serializes the access to the catalog queries map since catalogs can be used by different threads
+		static QMutex queries_mutex;
+
+		/*! \brief Stores the results of the catalog queries per database (the key is the connection id, see getConnectionId()).
+		Each database's results are indexed by the parameters used to build the query (see getCacheKey()) */
+		static map<QString, map<QString, vector<attribs_map>>> metadata_cache;
+
+		/*! \brief Stores the state of each cached database's catalog (see getChangeStampQuery()) at the moment its results started to be cached.
+		When the state differs from the current one the database's cached results are discarded */
+		static map<QString, QString> cache_stamps;
+
+		//! \brief Serializes the access to the metadata cache
+		static QMutex cache_mutex;
+
+		/*! \brief Query used to detect changes in a system catalog. It combines the amount of rows and the most recent
+		transaction id (xmin) of the catalog, so creating, changing or dropping objects produces a different value */
+		static const QString CHANGE_STAMP_SQL;
+
+		/*! \brief Stores the system catalogs checked by validateMetadataCache() (see CHANGE_STAMP_SQL) and the minimum
+		PostgreSQL version in which each one is available (empty for all supported versions) */
+		static map<QString, QString> stamp_catalogs;
+
+		//! \brief Indicates if the catalog stores/retrieves the queries results in/from the metadata cache
+		bool use_metadata_cache;
+
 		//! \brief Connection used to query the pg_catalog
 		Connection connection;
 
@@ -101,11 +128,18 @@ class Catalog {
 		//! \brief Returns the catalog query according to the type of the object type provided
 		QString getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result=false, attribs_map attribs=attribs_map());
 
-		/*! \brief Recreates the attribute map in such way that attribute names that have
-		underscores have this char replaced by dashes. Another special operation made is to replace
-		the values of fiels which suffix is _bool to '1' when 't' and to empty when 'f', this is because
-		the resultant attribs_map will be passed to XMLParser/SchemaParser which understands bool values as 1 (one) or '' (empty) */
-		attribs_map changeAttributeNames(const attribs_map &attribs);
+		/*! \brief Returns the attribute name related to a result's column name. Underscores in the column name
+		are replaced by dashes and the suffix _bool is removed. The parameter is_bool is set to true when the
+		column has the _bool suffix meaning its values must be converted by getResultAttributes() */
+		QString changeAttributeName(const QString &col_name, bool &is_bool);
+
+		/*! \brief Converts the tuples of the result, starting from the current one, to attribute maps and appends them to 'tuples'.
+		The attribute names (see changeAttributeName()) are resolved once per result and the values are read directly from the result's
+		memory. The values of fields which suffix is _bool are replaced to '1' when 't' and to empty when 'f', this is because
+		the resultant attribs_map will be passed to XMLParser/SchemaParser which understands bool values as 1 (one) or '' (empty).
+		If 'obj_type' is not BASE_OBJECT its code is inserted in each map as the attribute ParsersAttributes::OBJECT_TYPE.
+		When 'single_tuple' is true only the current tuple is converted */
+		void getResultAttributes(ResultSet &res, vector<attribs_map> &tuples, ObjectType obj_type=BASE_OBJECT, bool single_tuple=false);
 
 		//! \brief Returns a attribute set for the specified object type and name
 		attribs_map getAttributes(const QString &obj_name, ObjectType obj_type, attribs_map extra_attribs=attribs_map());
@@ -121,6 +155,21 @@ class Catalog {
 		//! \brief Creates a comma separated string containing all the oids to be filtered
 		QString createOidFilter(const vector<unsigned> &oids);
 
+		/*! \brief Returns the key that identifies the results of a catalog query in the metadata cache. An empty key is returned
+		for the queries whose results must not be cached since changes on them aren't detected by validateMetadataCache() */
+		QString getCacheKey(const QString &qry_type, ObjectType obj_type, bool single_result, const attribs_map &attribs);
+
+		/*! \brief Copies the cached results identified by the key to the provided vector. Returns false
+		if the results aren't cached yet or the metadata cache is disabled for the catalog */
+		bool getCachedResult(const QString &key, vector<attribs_map> &tuples);
+
+		//! \brief Stores the results in the metadata cache (only when it's enabled for the catalog)
+		void storeCachedResult(const QString &key, const vector<attribs_map> &tuples);
+
+		/*! \brief Returns the query that produces the state of the current database's catalog. The state is built from
+		all the system catalogs available in the server's version (see stamp_catalogs) plus a hash of the roles */
+		QString getChangeStampQuery(void);
+
 	public:
 		Catalog(void);
 		Catalog(const Catalog &catalog);
@@ -149,9 +198,29 @@ class Catalog {
 	catalog queries will fail */
 		void closeConnection(void);
 
+		/*! \brief Returns if the catalog's connection is currently opened and usable. A connection dropped by the server
+		or that exceeded the command execution timeout is considered closed so the caller can reopen it (see Connection::isAlive()) */
+		bool isConnectionStablished(void);
+
+		//! \brief Returns the identifier of the server and database in which the catalog is connected (see Connection::getConnectionId())
+		QString getConnectionId(void);
+
 		//! \brief Configures the catalog query filter
 		void setFilter(unsigned filter);
 
+		/*! \brief Starts a repeatable read transaction in the catalog's connection and exports its snapshot
+		so other catalogs can query the database in the very same state (see importSnapshot()).
+		Returns the snapshot identifier or an empty string if the server doesn't support snapshot exporting (prior to 9.2).
+		The transaction is kept opened until releaseSnapshot() is called */
+		QString exportSnapshot(void);
+
+		/*! \brief Starts a repeatable read transaction in the catalog's connection using the snapshot exported
+		by another catalog. The transaction is kept opened until releaseSnapshot() is called */
+		void importSnapshot(const QString &snapshot_id);
+
+		//! \brief Finishes the transaction started by exportSnapshot() or importSnapshot()
+		void releaseSnapshot(void);
+
 		//! \brief Returns the last system object oid registered on the database
 		unsigned getLastSysObjectOID(void);
 
@@ -208,6 +277,27 @@ class Catalog {
 		//! \brief Returns the current status of cached catalog queries
 		static bool isCachedQueriesEnabled(void);
 
+		/*! \brief Enable/disable the use of the metadata cache by the catalog. When enabled, the results of the catalog queries are
+		kept in memory (shared by all catalogs connected to the same database) and reused until a change in the database's catalog
+		is detected by validateMetadataCache() or until clearMetadataCache() is called */
+		void enableMetadataCache(bool value);
+
+		/*! \brief Discards the cached results of the current database if its catalog has changed since they were cached (see getChangeStampQuery()).
+		This method runs a query on the server so it should be called only when the user explicitly requests fresh metadata.
+		Returns true when the cached results were discarded */
+		bool validateMetadataCache(void);
+
+		/*! \brief Retrieves the last system oid and the objects created by extensions of the current database. Those values are
+		loaded when calling setConnection() so this method only needs to be called when the metadata cache is discarded meanwhile */
+		void reloadCatalogInfo(void);
+
+		//! \brief Returns if the metadata cache is enabled for the catalog
+		bool isMetadataCacheEnabled(void);
+
+		/*! \brief Discards the cached results of the database identified by the provided connection id (see Connection::getConnectionId(true, true)).
+		When no connection id is provided the cached results of all databases are discarded */
+		static void clearMetadataCache(const QString &conn_id=QString());
+
 		//! \brief Performs the copy between two catalogs
 		void operator = (const Catalog &catalog);
 };
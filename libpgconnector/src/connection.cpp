@@ -52,6 +52,7 @@ bool Connection::notice_enabled=false;
 bool Connection::print_sql=false;
 bool Connection::silence_conn_err=true;
 QStringList Connection::notices;
+QMutex Connection::notices_mutex;
 
 Connection::Connection(void)
 {
@@ -154,9 +155,16 @@ void Connection::generateConnectionString(void)
 
 void Connection::noticeProcessor(void *, const char *message)
 {
+	QMutexLocker locker(&notices_mutex);
 	notices.push_back(QString(message));
 }
 
+void Connection::clearNotices(void)
+{
+	QMutexLocker locker(&notices_mutex);
+	notices.clear();
+}
+
 void Connection::validateConnectionStatus(void)
 {
 	if(cmd_exec_timeout > 0)
@@ -242,7 +250,7 @@ void Connection::connect(void)
 						__PRETTY_FUNCTION__, __FILE__, __LINE__);
 	}
 
-	notices.clear();
+	clearNotices();
 
 	if(!notice_enabled)
 		//Completely disable notice/warnings in the connection
@@ -256,9 +264,9 @@ void Connection::close(void)
 {
 	if(connection)
 	{
-		//Finalizes the connection if the status is OK
-		if(PQstatus(connection)==CONNECTION_OK)
-			PQfinish(connection);
+		/* Finalizes the connection even if its status is bad (e.g. dropped by the server)
+		since the memory used by the connection descriptor must be released anyway */
+		PQfinish(connection);
 
 		connection=nullptr;
 		last_cmd_execution=QDateTime();
@@ -327,6 +335,15 @@ bool Connection::isStablished(void)
 	return(connection!=nullptr);
 }
 
+bool Connection::isAlive(void)
+{
+	if(!connection || PQstatus(connection)==CONNECTION_BAD)
+		return(false);
+
+	return(cmd_exec_timeout == 0 ||
+				 ((QDateTime::currentDateTime().toMSecsSinceEpoch() - last_cmd_execution.toMSecsSinceEpoch())/1000) < cmd_exec_timeout);
+}
+
 bool Connection::isAutoBrowseDB(void)
 {
 	return(auto_browse_db);
@@ -367,12 +384,12 @@ QString  Connection::getPgSQLVersion(bool major_only)
 
 QStringList Connection::getNotices(void)
 {
+	QMutexLocker locker(&notices_mutex);
 	return (notices);
 }
 
 void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 {
-	ResultSet *new_res=nullptr;
 	PGresult *sql_res=nullptr;
 
 	//Raise an error in case the user try to close a not opened connection
@@ -380,7 +397,7 @@ void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 
 	validateConnectionStatus();
-	notices.clear();
+	clearNotices();
 
 	//Alocates a new result to receive the resultset returned by the sql command
 	sql_res=PQexec(connection, sql.toStdString().c_str());
@@ -401,15 +418,17 @@ void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 						QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE)));
 	}
 
-	//Generates the resultset based on the sql result descriptor
-	new_res=new ResultSet(sql_res);
-
-	//Copy the new resultset to the parameter resultset
-	result=*(new_res);
-
-	//Deallocate the new resultset
-	delete(new_res);
-	PQclear(sql_res);
+	try
+	{
+		/* Generates the resultset based on the sql result descriptor moving it
+		to the parameter resultset, which becomes the owner of the result */
+		result=ResultSet(sql_res);
+	}
+	catch(Exception &e)
+	{
+		PQclear(sql_res);
+		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+	}
 }
 
 void Connection::executeDDLCommand(const QString &sql)
@@ -421,7 +440,7 @@ void Connection::executeDDLCommand(const QString &sql)
 		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 
 	validateConnectionStatus();
-	notices.clear();
+	clearNotices();
 	sql_res=PQexec(connection, sql.toStdString().c_str());
 
 	//Prints the SQL to stdout when the flag is active
@@ -446,6 +465,437 @@ void Connection::executeDDLCommand(const QString &sql)
 	PQclear(sql_res);
 }
 
+void Connection::executeDDLCommands(const vector<QString> &cmds, unsigned batch_size, const function<void(unsigned, Exception &)> &error_handler)
+{
+	unsigned idx=0, last=0;
+	bool batch_failed=false;
+	Exception err;
+
+	auto executeAlone=[&](unsigned cmd_idx){
+		try
+		{
+			executeDDLCommand(cmds[cmd_idx]);
+		}
+		catch(Exception &e)
+		{
+			error_handler(cmd_idx, e);
+		}
+	};
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(batch_size==0)
+		batch_size=1;
+
+	while(idx < cmds.size())
+	{
+		//Commands that can't be executed inside a transaction or in batches of one command are executed separately
+		if(batch_size==1 || !isTransactionBlockAllowed(cmds[idx]))
+		{
+			executeAlone(idx++);
+			continue;
+		}
+
+		//Determining the last command of the batch
+		for(last=idx; last + 1 < cmds.size() && (last + 1 - idx) < batch_size && isTransactionBlockAllowed(cmds[last + 1]); last++);
+
+		idx=executeDDLBatch(cmds, idx, last, batch_failed, err);
+
+		/* If the batch fails as a whole nothing was executed, so the commands are
+		executed one by one in order to identify the ones that caused the error */
+		if(batch_failed)
+		{
+			for(; idx <= last; idx++)
+				executeAlone(idx);
+		}
+		else if(idx <= last)
+			error_handler(idx++, err);
+	}
+}
+
+unsigned Connection::executeDDLBatch(const vector<QString> &cmds, unsigned first, unsigned last, bool &batch_failed, Exception &err)
+{
+	static const QString savepoint=QString("SAVEPOINT pgmodeler_batch;\n");
+	PGresult *sql_res=nullptr;
+	QString batch=QString("BEGIN;\n"), err_msg, err_code;
+	int savepoint_cnt=0;
+	unsigned failed_idx=0;
+
+	validateConnectionStatus();
+	clearNotices();
+
+	/* The savepoint before each command permits to roll back only the one that failed and the number of savepoints
+	executed identifies it. The last savepoint separates the commands from the COMMIT so a failure on it can be detected */
+	for(unsigned idx=first; idx <= last; idx++)
+		batch+=savepoint + cmds[idx] + QString("\n;\n");
+
+	batch+=savepoint + QString("COMMIT;");
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+	{
+		QTextStream out(stdout);
+		out << QString("\n---\n") << batch << endl;
+	}
+
+	if(!PQsendQuery(connection, batch.toStdString().c_str()))
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+						.arg(PQerrorMessage(connection)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	//The server stops executing the batch at the first error so only one error result is expected
+	while((sql_res=PQgetResult(connection)))
+	{
+		if(PQresultStatus(sql_res)==PGRES_COMMAND_OK && strcmp(PQcmdStatus(sql_res), "SAVEPOINT")==0)
+			savepoint_cnt++;
+		else if(PQresultStatus(sql_res)==PGRES_FATAL_ERROR && err_msg.isEmpty())
+		{
+			err_msg=QString(PQresultErrorMessage(sql_res));
+			err_code=QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+		}
+
+		PQclear(sql_res);
+	}
+
+	if(err_msg.isEmpty())
+	{
+		batch_failed=false;
+		return(last + 1);
+	}
+
+	failed_idx=first + savepoint_cnt - 1;
+
+	/* If no savepoint was created (e.g. the batch has syntax errors) or the error happened after the last command
+	(e.g. deferred constraints checked on COMMIT) the whole transaction was rolled back */
+	if(savepoint_cnt==0 || failed_idx > last)
+	{
+		PQclear(PQexec(connection, "ROLLBACK;"));
+		batch_failed=true;
+		return(first);
+	}
+
+	//Rolling back only the failed command and commiting the previous ones
+	executeDDLCommand(QString("ROLLBACK TO SAVEPOINT pgmodeler_batch; COMMIT;"));
+
+	batch_failed=false;
+	err=Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED)).arg(err_msg),
+								ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr, err_code);
+
+	return(failed_idx);
+}
+
+bool Connection::isTransactionBlockAllowed(const QString &cmd)
+{
+	static const QStringList not_allowed_cmds={ QString("CREATE DATABASE"), QString("DROP DATABASE"),
+												QString("CREATE TABLESPACE"), QString("DROP TABLESPACE"),
+												QString("ALTER SYSTEM"), QString("VACUUM"),
+												QString("REINDEX DATABASE"), QString("REINDEX SYSTEM") };
+	QString aux_cmd=cmd.simplified().toUpper();
+
+	for(auto &not_allowed : not_allowed_cmds)
+	{
+		if(aux_cmd.startsWith(not_allowed))
+			return(false);
+	}
+
+	return(!aux_cmd.contains(QString(" CONCURRENTLY ")) &&
+				 !(aux_cmd.startsWith(QString("ALTER TYPE")) && aux_cmd.contains(QString(" ADD VALUE "))));
+}
+
+void Connection::sendCommand(const QString &sql, bool single_row)
+{
+	//Raise an error in case the user try to close a not opened connection
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	validateConnectionStatus();
+	clearNotices();
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+	{
+		QTextStream out(stdout);
+		out << QString("\n---\n") << sql << endl;
+	}
+
+	if(!PQsendQuery(connection, sql.toStdString().c_str()))
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+						.arg(PQerrorMessage(connection)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	if(single_row)
+		PQsetSingleRowMode(connection);
+}
+
+bool Connection::isAsyncResultReady(void)
+{
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(!PQconsumeInput(connection))
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+						.arg(PQerrorMessage(connection)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	return(!PQisBusy(connection));
+}
+
+bool Connection::getAsyncResult(ResultSet &result)
+{
+	PGresult *sql_res=nullptr;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	sql_res=PQgetResult(connection);
+
+	//A null result indicates that the command has finished
+	if(!sql_res)
+		return(false);
+
+	if(PQresultStatus(sql_res)==PGRES_FATAL_ERROR)
+	{
+		QString err_msg=QString(PQresultErrorMessage(sql_res)),
+				field=QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+
+		PQclear(sql_res);
+
+		//Discarding the remaining results so the connection can be used to run other commands
+		while((sql_res=PQgetResult(connection)))
+			PQclear(sql_res);
+
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED)).arg(err_msg),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr, field);
+	}
+
+	try
+	{
+		//Generates the resultset based on the sql result descriptor moving it to the parameter resultset
+		result=ResultSet(sql_res);
+	}
+	catch(Exception &e)
+	{
+		PQclear(sql_res);
+		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__, __FILE__, __LINE__, &e);
+	}
+
+	return(true);
+}
+
+void Connection::startCopyIn(const QString &copy_cmd)
+{
+	PGresult *sql_res=nullptr;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	validateConnectionStatus();
+	clearNotices();
+	sql_res=PQexec(connection, copy_cmd.toStdString().c_str());
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+	{
+		QTextStream out(stdout);
+		out << QString("\n---\n") << copy_cmd << endl;
+	}
+
+	if(PQresultStatus(sql_res)!=PGRES_COPY_IN)
+	{
+		QString field=QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+
+		PQclear(sql_res);
+
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+						.arg(PQerrorMessage(connection)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr, field);
+	}
+
+	PQclear(sql_res);
+}
+
+void Connection::putCopyData(const QByteArray &data)
+{
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(PQputCopyData(connection, data.constData(), data.size())!=1)
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+						.arg(PQerrorMessage(connection)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+}
+
+unsigned Connection::endCopyIn(const QString &error_msg)
+{
+	PGresult *sql_res=nullptr;
+	QString err_msg, field;
+	unsigned row_cnt=0;
+	bool aborted=!error_msg.isEmpty();
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(PQputCopyEnd(connection, aborted ? error_msg.toStdString().c_str() : nullptr)!=1)
+		err_msg=QString(PQerrorMessage(connection));
+
+	//Retrieving the final status of the COPY command
+	while((sql_res=PQgetResult(connection)))
+	{
+		if(PQresultStatus(sql_res)==PGRES_COMMAND_OK)
+			row_cnt+=QString(PQcmdTuples(sql_res)).toUInt();
+		else if(err_msg.isEmpty())
+		{
+			err_msg=QString(PQresultErrorMessage(sql_res));
+			field=QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+		}
+
+		PQclear(sql_res);
+	}
+
+	//When aborting the error reported by the server is the one caused by the abortion itself so it's ignored
+	if(!aborted && !err_msg.isEmpty())
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED)).arg(err_msg),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr, field);
+	}
+
+	return(row_cnt);
+}
+
+void Connection::startCopyOut(const QString &copy_cmd)
+{
+	PGresult *sql_res=nullptr;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	validateConnectionStatus();
+	clearNotices();
+	sql_res=PQexec(connection, copy_cmd.toStdString().c_str());
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+	{
+		QTextStream out(stdout);
+		out << QString("\n---\n") << copy_cmd << endl;
+	}
+
+	if(PQresultStatus(sql_res)!=PGRES_COPY_OUT)
+	{
+		QString field=QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+
+		PQclear(sql_res);
+
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+						.arg(PQerrorMessage(connection)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr, field);
+	}
+
+	PQclear(sql_res);
+}
+
+bool Connection::getCopyData(QByteArray &data)
+{
+	char *buffer=nullptr;
+	int len=0;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	len=PQgetCopyData(connection, &buffer, 0);
+
+	if(len==-2)
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+						.arg(PQerrorMessage(connection)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	//A negative length (-1) indicates that the copy is done
+	if(len < 0)
+	{
+		data.clear();
+		return(false);
+	}
+
+	data=QByteArray(buffer, len);
+	PQfreemem(buffer);
+	return(true);
+}
+
+unsigned Connection::endCopyOut(void)
+{
+	PGresult *sql_res=nullptr;
+	QString err_msg, field;
+	unsigned row_cnt=0;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	//Retrieving the final status of the COPY command
+	while((sql_res=PQgetResult(connection)))
+	{
+		if(PQresultStatus(sql_res)==PGRES_COMMAND_OK)
+			row_cnt+=QString(PQcmdTuples(sql_res)).toUInt();
+		else if(err_msg.isEmpty())
+		{
+			err_msg=QString(PQresultErrorMessage(sql_res));
+			field=QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+		}
+
+		PQclear(sql_res);
+	}
+
+	if(!err_msg.isEmpty())
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED)).arg(err_msg),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr, field);
+	}
+
+	return(row_cnt);
+}
+
+void Connection::cancelCommand(void)
+{
+	PGcancel *cancel=nullptr;
+	char err_msg[256]={0};
+	bool canceled=false;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	cancel=PQgetCancel(connection);
+
+	if(cancel)
+	{
+		canceled=PQcancel(cancel, err_msg, sizeof(err_msg));
+		PQfreeCancel(cancel);
+	}
+
+	if(!canceled)
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED)).arg(QString(err_msg)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+}
+
+int Connection::getSocketDescriptor(void)
+{
+	if(!connection)
+		return(-1);
+
+	return(PQsocket(connection));
+}
+
 void Connection::setDefaultForOperation(unsigned op_id, bool value)
 {
 	if(op_id > OP_NONE)
@@ -30,6 +30,8 @@
 #include "attribsmap.h"
 #include <QRegExp>
 #include <QDateTime>
+#include <QMutex>
+#include <functional>
 
 class Connection {
 	private:
@@ -56,6 +58,10 @@ class Connection {
 		The list is filled only if notice_enabled is true */
 		static QStringList notices;
 
+		/*! \brief Serializes the access to the notices list since connections can be used
+		at the same time by different threads (e.g. parallel catalog queries) */
+		static QMutex notices_mutex;
+
 		//! \brief Generates the connection string based on the parameter map
 		void generateConnectionString(void);
 
@@ -71,6 +77,9 @@ class Connection {
 		for later usage */
 		static void noticeProcessor(void *, const char *message);
 
+		//! \brief Clears the list of notices generated by the last command execution
+		static void clearNotices(void);
+
 		//! \brief Indicates if notices are enabled
 		static bool notice_enabled,
 
@@ -93,6 +102,16 @@ class Connection {
 		command execution */
 		void validateConnectionStatus(void);
 
+		/*! \brief Executes the commands in the range [first, last] as a single multi-statement command inside a transaction
+		where each command is preceded by a savepoint. Returns the index of the first command not executed due to an error
+		(which is rolled back while the previous ones are commited) or a value greater than 'last' if all commands were executed.
+		When the batch fails as a whole (e.g. syntax errors) the returned index is 'first' and 'err' is not filled */
+		unsigned executeDDLBatch(const vector<QString> &cmds, unsigned first, unsigned last, bool &batch_failed, Exception &err);
+
+		/*! \brief Returns if the command can be executed inside a transaction block. Commands like CREATE DATABASE,
+		CREATE INDEX CONCURRENTLY, ALTER TYPE ... ADD VALUE and others must be executed alone */
+		static bool isTransactionBlockAllowed(const QString &cmd);
+
 	public:
 		//! \brief Constants used to reference the connections parameters
 		static const QString	PARAM_ALIAS,
@@ -211,6 +230,11 @@ class Connection {
 		//! \brief Returns if the connections is stablished
 		bool isStablished(void);
 
+		/*! \brief Returns if the connection is stablished and can still execute commands, this is, it wasn't
+		dropped by the server (e.g. server restart) nor exceeded the command execution timeout. Differently from isStablished(),
+		this method tells if the connection must be reopened before being used again */
+		bool isAlive(void);
+
 		//! \brief Returns if the db configured in the connection can be automatically browsed in SQLTool
 		bool isAutoBrowseDB(void);
 
@@ -223,6 +247,58 @@ class Connection {
 		 to be an data definition one  */
 		void executeDDLCommand(const QString &sql);
 
+		/*! \brief Executes several DDL commands reducing the round trips to the server. The commands are sent in batches
+		of at most 'batch_size' commands, each batch running in a transaction with a savepoint before each command, so the
+		command that failed is exactly identified, rolled back and reported to 'error_handler' along with its index.
+		The successful commands of a batch are always commited and the execution continues after the failed command unless
+		the error handler raises an exception, in that case the execution is aborted and the exception is redirected.
+		Commands that can't run inside a transaction block are executed alone. A batch size of 1 makes each command
+		to be executed separately as done by executeDDLCommand() */
+		void executeDDLCommands(const vector<QString> &cmds, unsigned batch_size, const function<void(unsigned, Exception &)> &error_handler);
+
+		/*! \brief Sends a command to the server without waiting for its results (asynchronous execution).
+		The results must be retrieved through getAsyncResult() when isAsyncResultReady() returns true.
+		If single_row is true the tuples are delivered one by one as soon as they arrive from the server */
+		void sendCommand(const QString &sql, bool single_row=false);
+
+		/*! \brief Reads the data available in the connection socket and returns true when a result of the
+		command sent by sendCommand() can be retrieved without blocking */
+		bool isAsyncResultReady(void);
+
+		/*! \brief Retrieves the next result of the command sent by sendCommand(). Returns false when there are
+		no more results, that is, the command has finished. Raises an exception if the command failed */
+		bool getAsyncResult(ResultSet &result);
+
+		/*! \brief Requests the server to cancel the command sent by sendCommand(). The cancellation is reported
+		as an error when retrieving the results of the command */
+		void cancelCommand(void);
+
+		/*! \brief Executes a COPY ... FROM STDIN command putting the connection in copy in state. The data must be sent
+		through putCopyData() and the operation must always be finished by endCopyIn() */
+		void startCopyIn(const QString &copy_cmd);
+
+		//! \brief Sends a chunk of data (in the format expected by the COPY command) to the server
+		void putCopyData(const QByteArray &data);
+
+		/*! \brief Finishes the copy in operation returning the amount of rows inserted. If an error message is
+		provided the operation is aborted (nothing is inserted) and the server's error is not raised */
+		unsigned endCopyIn(const QString &error_msg=QString());
+
+		/*! \brief Executes a COPY ... TO STDOUT command putting the connection in copy out state. The data must be
+		retrieved through getCopyData() until it returns false and the operation must be finished by endCopyOut() */
+		void startCopyOut(const QString &copy_cmd);
+
+		/*! \brief Retrieves the next row sent by the server (in the format requested in the COPY command) storing it
+		in the provided buffer. Returns false when there's no more data to be read */
+		bool getCopyData(QByteArray &data);
+
+		//! \brief Finishes the copy out operation returning the amount of rows copied
+		unsigned endCopyOut(void);
+
+		/*! \brief Returns the descriptor of the connection socket which can be used to be notified
+		about the arrival of asynchronous results (e.g. through QSocketNotifier) or -1 if the connection is not opened */
+		int getSocketDescriptor(void);
+
 		//! \brief Toggles the default status for the connect in the specified operation (OP_??? constants).
 		void setDefaultForOperation(unsigned op_id, bool value);
 
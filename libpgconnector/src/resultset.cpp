@@ -22,10 +22,17 @@ ResultSet::ResultSet(void)
 {
 	sql_result=nullptr;
 	empty_result=false;
-	is_res_copied=false;
 	current_tuple=-1;
 }
 
+ResultSet::ResultSet(ResultSet &&res)
+{
+	sql_result=nullptr;
+	empty_result=false;
+	current_tuple=-1;
+	*this=std::move(res);
+}
+
 ResultSet::ResultSet(PGresult *sql_result)
 {
 	QString str_aux;
@@ -55,12 +62,12 @@ ResultSet::ResultSet(PGresult *sql_result)
 			//In case of sucess states the result will be created
 		case PGRES_COMMAND_OK:
 		case PGRES_TUPLES_OK:
+		case PGRES_SINGLE_TUPLE:
 		case PGRES_COPY_OUT:
 		case PGRES_COPY_IN:
 		default:
-			empty_result=(res_state!=PGRES_TUPLES_OK && res_state!=PGRES_EMPTY_QUERY);
+			empty_result=(res_state!=PGRES_TUPLES_OK && res_state!=PGRES_SINGLE_TUPLE && res_state!=PGRES_EMPTY_QUERY);
 			current_tuple=-1;
-			is_res_copied=false;
 		break;
 	}
 }
@@ -72,15 +79,14 @@ ResultSet::~ResultSet(void)
 
 void ResultSet::destroyResultSet(void)
 {
-	/* Destroy the resultset of the object if it was not copied
-		to another class instance (see 'operator =') */
-	if(sql_result && !is_res_copied)
+	/* Destroy the result held by the object. If it was moved
+		to another instance (see 'operator =') the pointer is already null */
+	if(sql_result)
 		PQclear(sql_result);
 
 	//Reset the other attributes
 	sql_result=nullptr;
 	empty_result=false;
-	is_res_copied=false;
 	current_tuple=-1;
 }
 
@@ -94,6 +100,17 @@ QString ResultSet::getColumnName(int column_idx)
 	return(QString(PQfname(sql_result, column_idx)));
 }
 
+QStringList ResultSet::getColumnNames(void)
+{
+	QStringList names;
+	int col_cnt=getColumnCount();
+
+	for(int col=0; col < col_cnt; col++)
+		names.push_back(PQfname(sql_result, col));
+
+	return(names);
+}
+
 unsigned ResultSet::getColumnTypeId(int column_idx)
 {
 	//Throws an error in case the column index is invalid
@@ -163,6 +180,18 @@ char *ResultSet::getColumnValue(int column_idx)
 	return(PQgetvalue(sql_result, current_tuple, column_idx));
 }
 
+QByteArray ResultSet::getColumnData(int column_idx)
+{
+	if(column_idx < 0 || column_idx >= getColumnCount())
+		throw Exception(ERR_REF_TUPLE_COL_INV_INDEX, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	else if(empty_result || current_tuple < 0 || current_tuple >= PQntuples(sql_result))
+		throw Exception(ERR_REF_INV_TUPLE_COLUMN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	//The byte array only points to the value stored by libpq so no deep copy is made
+	return(QByteArray::fromRawData(PQgetvalue(sql_result, current_tuple, column_idx),
+																 PQgetlength(sql_result, current_tuple, column_idx)));
+}
+
 int ResultSet::getColumnSize(const QString &column_name)
 {
 	int col_idx=-1;
@@ -312,25 +341,37 @@ bool ResultSet::accessTuple(unsigned tuple_type)
 	}
 }
 
+bool ResultSet::setCurrentTuple(int tuple_idx)
+{
+	if(empty_result || tuple_idx < 0 || tuple_idx >= PQntuples(sql_result))
+		return(false);
+
+	current_tuple=tuple_idx;
+	return(true);
+}
+
 bool ResultSet::isEmpty(void)
 {
 	return(empty_result);
 }
 
-void ResultSet::operator = (ResultSet &res)
+ResultSet &ResultSet::operator = (ResultSet &&res)
 {
-	/* Mark the result parameter as copied, avoiding
-		the sql_result attribute to be deallocated */
-	res.is_res_copied=true;
-
-	/* If the resultset 'this' is allocated,
+	if(this!=&res)
+	{
+		/* If the resultset 'this' is allocated,
 		it will be deallocated to avoid memory leaks */
-	destroyResultSet();
+		destroyResultSet();
 
-	//Copy the parameter restulset attributes to 'this' resultset
-	this->current_tuple=res.current_tuple;
-	this->empty_result=res.empty_result;
-	this->sql_result=PQcopyResult(res.sql_result, PG_COPYRES_TUPLES | PG_COPYRES_ATTRS | PG_COPYRES_EVENTS);
-	this->is_res_copied=false;
-}
+		//Takes the ownership of the parameter's result instead of copying its tuples
+		this->current_tuple=res.current_tuple;
+		this->empty_result=res.empty_result;
+		this->sql_result=res.sql_result;
 
+		res.sql_result=nullptr;
+		res.empty_result=false;
+		res.current_tuple=-1;
+	}
+
+	return(*this);
+}
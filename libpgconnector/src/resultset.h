@@ -32,20 +32,15 @@ It the resultset contains data the user must call ResultSet::accessTuple() to ac
 #include <libpq-fe.h>
 #include <cstdlib>
 #include <iostream>
+#include <utility>
+#include <QStringList>
+#include <QByteArray>
 
 //This constant is defined on PostgreSQL source code src/catalog/pg_type.h
 #define BYTEAOID 17
 
 class ResultSet {
 	private:
-		/*! \brief Indicates whether the result was copied, this flag is used
-	 to avoid segmentation faults when calling the destructor.
-	 As the pointer 'sql_result' is copied
-	 to other elements if it is destroyed can cause
-	 reference fails. Thus, such a pointer is only deleted
-	 when this flag is marked as false */
-		bool is_res_copied;
-
 		void destroyResultSet(void);
 
 	protected:
@@ -60,7 +55,8 @@ class ResultSet {
 		PGresult *sql_result;
 
 		/*! \brief This class may be constructed from a
-	 result of SQL command generated in DBConnection class */
+	 result of SQL command generated in DBConnection class.
+	 The resultset takes the ownership of the provided result */
 		ResultSet(PGresult *sql_result);
 
 	public:
@@ -71,12 +67,25 @@ class ResultSet {
 		NEXT_TUPLE=3;
 
 		ResultSet(void);
+
+		/*! \brief Moves the result of the provided resultset to the new one without copying the tuples.
+		The provided resultset is left empty (without a result) */
+		ResultSet(ResultSet &&res);
+
+		//! \brief Resultsets can't be copied since they are the only owners of the underlying libpq result
+		ResultSet(const ResultSet &)=delete;
+
 		~ResultSet(void);
 
 		//! \brief Returns the value of a column (searching by name or index)
 		char *getColumnValue(const QString &column_name);
 		char *getColumnValue(int column_idx);
 
+		/*! \brief Returns the value of a column on the current tuple as a byte array that references the memory of the underlying result
+		(no data is copied). The returned array is valid only while this resultset holds the current result. This method is intended
+		for loops that read a large amount of tuples and resolve the column indexes once (see getColumnNames()) */
+		QByteArray getColumnData(int column_idx);
+
 		//! \brief Returns the data allocated size of a column (searching by name or index)
 		int getColumnSize(const QString &column_name);
 		int getColumnSize(int column_idx);
@@ -95,6 +104,9 @@ class ResultSet {
 		//! \brief Returns the name of the column specified by it's index
 		QString getColumnName(int column_idx);
 
+		//! \brief Returns the names of all columns in the same order of their indexes
+		QStringList getColumnNames(void);
+
 		//! \brief Returns the type OID of the column specified by it's index
 		unsigned getColumnTypeId(int column_idx);
 
@@ -111,11 +123,18 @@ class ResultSet {
 		//! \brief Access on tuple on result set via navigation constants
 		bool accessTuple(unsigned tuple_type);
 
+		/*! \brief Moves the navigation directly to the tuple in the specified index. Returns false
+		when the index is out of bounds, in that case the current tuple is not changed */
+		bool setCurrentTuple(int tuple_idx);
+
 		//! \brief Returns if the result set is empty due a DML command that does not returned any data
 		bool isEmpty(void);
 
-		//! \brief Make a copy between two resultsets
-		void operator = (ResultSet &res);
+		/*! \brief Transfers the result of the provided resultset to this one without copying the tuples,
+		destroying the result previously held. The provided resultset is left empty (without a result) */
+		ResultSet &operator = (ResultSet &&res);
+
+		ResultSet &operator = (const ResultSet &)=delete;
 
 		friend class Connection;
 };
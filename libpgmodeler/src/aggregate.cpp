@@ -162,6 +162,7 @@ void Aggregate::addDataType(PgSQLType type)
 {
 	data_types.push_back(type);
 	setCodeInvalidated(true);
+	notifySignatureChange();
 }
 
 void Aggregate::removeDataType(unsigned type_idx)
@@ -173,12 +174,14 @@ void Aggregate::removeDataType(unsigned type_idx)
 	//Removes the type at the specified position
 	data_types.erase(data_types.begin() + type_idx);
 	setCodeInvalidated(true);
+	notifySignatureChange();
 }
 
 void Aggregate::removeDataTypes(void)
 {
 	data_types.clear();
 	setCodeInvalidated(true);
+	notifySignatureChange();
 }
 
 unsigned Aggregate::getDataTypeCount(void)
@@ -340,6 +340,22 @@ BaseObject *BaseObject::getDatabase(void)
 	return(this->database);
 }
 
+void BaseObject::notifySignatureChange(void)
+{
+	if(database)
+		database->updateObjectIndex(this);
+}
+
+void BaseObject::updateObjectIndex(BaseObject *)
+{
+
+}
+
+void BaseObject::updateObjectReferences(BaseObject *)
+{
+
+}
+
 void BaseObject::setProtected(bool value)
 {
 	setCodeInvalidated(this->is_protected != value);
@@ -365,7 +381,12 @@ void BaseObject::setName(const QString &name)
 
 	aux_name.remove('"');
 	setCodeInvalidated(this->obj_name!=aux_name);
-	this->obj_name=aux_name;
+
+	if(this->obj_name!=aux_name)
+	{
+		this->obj_name=aux_name;
+		notifySignatureChange();
+	}
 }
 
 void BaseObject::setComment(const QString &comment)
@@ -491,7 +512,12 @@ void BaseObject::setSchema(BaseObject *schema)
 		throw Exception(ERR_ASG_INV_SCHEMA_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	setCodeInvalidated(this->schema != schema);
-	this->schema=schema;
+
+	if(this->schema != schema)
+	{
+		this->schema=schema;
+		notifySignatureChange();
+	}
 }
 
 void BaseObject::setOwner(BaseObject *owner)
@@ -976,6 +1002,8 @@ void BaseObject::enableCachedCode(bool value)
 
 void BaseObject::operator = (BaseObject &obj)
 {
+	bool sig_changed=(this->obj_name!=obj.obj_name || this->schema!=obj.schema);
+
 	this->owner=obj.owner;
 	this->schema=obj.schema;
 	this->tablespace=obj.tablespace;
@@ -987,10 +1015,18 @@ void BaseObject::operator = (BaseObject &obj)
 	this->sql_disabled=obj.sql_disabled;
 	this->system_obj=obj.system_obj;
 	this->setCodeInvalidated(use_cached_code);
+
+	if(sig_changed)
+		notifySignatureChange();
 }
 
 void BaseObject::setCodeInvalidated(bool value)
 {
+	/* Any change on the references held by the object invalidates its code so the database is notified
+	even when the code cache is disabled in order to keep its references index up to date */
+	if(value && database)
+		database->updateObjectReferences(this);
+
 	if(use_cached_code && value!=code_invalidated)
 	{
 		if(value)
@@ -220,6 +220,18 @@ class BaseObject {
 
 		static QString getAlterDefinition(QString sch_name, attribs_map &attribs, bool ignore_ukn_attribs=false, bool ignore_empty_attribs=false);
 
+		/*! \brief Notifies the database that owns the object (if any) that the object's signature has changed.
+		This method must be called by every operation that changes the value returned by getSignature() */
+		void notifySignatureChange(void);
+
+		/*! \brief Handles the signature change of the passed object. Here this method does nothing, it's
+		reimplemented by DatabaseModel in order to keep its lookup indexes up to date */
+		virtual void updateObjectIndex(BaseObject *);
+
+		/*! \brief Handles the code invalidation of the passed object. Here this method does nothing, it's
+		reimplemented by DatabaseModel in order to keep its references index up to date */
+		virtual void updateObjectReferences(BaseObject *);
+
 	public:
 		//! \brief Maximum number of characters that an object name on PostgreSQL can have
 		static const int OBJECT_NAME_MAX_LENGTH=63;
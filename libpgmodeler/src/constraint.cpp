@@ -231,6 +231,7 @@ void Constraint::setColumnsAttribute(unsigned col_type, unsigned def_type, bool
 
 void Constraint::setReferencedTable(BaseTable *tab_ref)
 {
+	setCodeInvalidated(ref_table != tab_ref);
 	this->ref_table=tab_ref;
 }
 
@@ -450,7 +450,17 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 			obj_list->push_back(object);
 	}
 
+	//Registering the object on the lookup index (if it was already built)
+	if(obj_indexes.count(obj_type))
+	{
+		QString signature=object->getSignature().remove('"');
+
+		if(!obj_indexes[obj_type].contains(signature))
+			obj_indexes[obj_type][signature]=object;
+	}
+
 	object->setDatabase(this);
+	indexObjectReferences(object);
 	emit s_objectAdded(object);
 	this->setInvalidated(true);
 }
@@ -519,6 +529,21 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 
 				obj_list->erase(obj_list->begin() + obj_idx);
 			}
+
+			if(obj_indexes.count(obj_type))
+			{
+				QHash<QString, BaseObject *> &obj_index=obj_indexes[obj_type];
+				QString signature=object->getSignature().remove('"');
+
+				/* If the object isn't indexed by its current signature the index is discarded
+				 to avoid keeping a dangling reference to the removed object */
+				if(obj_index.value(signature)==object)
+					obj_index.remove(signature);
+				else
+					obj_indexes.erase(obj_type);
+			}
+
+			unindexObjectReferences(object);
 		}
 
 		object->setDatabase(nullptr);
@@ -583,41 +608,59 @@ vector<BaseObject *> DatabaseModel::getObjects(BaseObject *schema)
 
 BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type, int &obj_idx)
 {
-	BaseObject *object=nullptr;
-	vector<BaseObject *> *obj_list=nullptr;
-	vector<BaseObject *>::iterator itr, itr_end;
-	bool found=false;
-	QString aux_name1;
+	BaseObject *object=getObject(name, obj_type);
 
-	obj_list=getObjectList(obj_type);
+	obj_idx=-1;
 
-	if(!obj_list)
-		throw Exception(ERR_OBT_OBJ_INVALID_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-	else
+	//The object's position is determined only for the callers that need it
+	if(object)
+	{
+		vector<BaseObject *> *obj_list=getObjectList(obj_type);
+		vector<BaseObject *>::iterator itr=std::find(obj_list->begin(), obj_list->end(), object);
+		obj_idx=(itr-obj_list->begin());
+	}
+
+	return(object);
+}
+
+QHash<QString, BaseObject *> &DatabaseModel::getLookupIndex(ObjectType obj_type)
+{
+	if(obj_indexes.count(obj_type)==0)
 	{
+		QHash<QString, BaseObject *> &obj_index=obj_indexes[obj_type];
+		vector<BaseObject *> *obj_list=getObjectList(obj_type);
 		QString signature;
 
-		itr=obj_list->begin();
-		itr_end=obj_list->end();
-		obj_idx=-1;
-		aux_name1=QString(name).remove('"');
+		obj_index.reserve(obj_list->size());
 
-		while(itr!=itr_end && !found)
+		/* In case of objects with the same signature only the first one is indexed
+		 in order to keep the same result of a sequential search on the list */
+		for(auto &object : *obj_list)
 		{
-			signature=(*itr)->getSignature().remove("\"");
-			found=(signature==aux_name1);
-			if(!found) itr++;
-		}
+			signature=object->getSignature().remove('"');
 
-		if(found)
-		{
-			object=(*itr);
-			obj_idx=(itr-obj_list->begin());
+			if(!obj_index.contains(signature))
+				obj_index[signature]=object;
 		}
-		else obj_idx=-1;
 	}
 
-	return(object);
+	return(obj_indexes[obj_type]);
+}
+
+void DatabaseModel::updateObjectIndex(BaseObject *object)
+{
+	ObjectType obj_type=object->getObjectType();
+
+	if(obj_type==OBJ_SCHEMA)
+		obj_indexes.clear();
+	else
+	{
+		obj_indexes.erase(obj_type);
+		obj_indexes.erase(OBJ_FUNCTION);
+		obj_indexes.erase(OBJ_OPERATOR);
+		obj_indexes.erase(OBJ_AGGREGATE);
+		obj_indexes.erase(OBJ_CAST);
+	}
 }
 
 BaseObject *DatabaseModel::getObject(unsigned obj_idx, ObjectType obj_type)
@@ -761,6 +804,9 @@ void DatabaseModel::destroyObjects(void)
 	//Removing the special objects first
 	storeSpecialObjectsXML();
 	disconnectRelationships();
+	obj_indexes.clear();
+	obj_referrers.clear();
+	indexed_refs.clear();
 
 	for(i=0; i < cnt; i++)
 	{
@@ -787,6 +833,11 @@ void DatabaseModel::destroyObjects(void)
 		}
 	}
 
+	//Discarding the lookup and references indexes since the non graphical objects were removed directly from their lists
+	obj_indexes.clear();
+	obj_referrers.clear();
+	indexed_refs.clear();
+	outdated_refs.clear();
 	PgSQLType::removeUserTypes(this);
 }
 
@@ -1308,13 +1359,87 @@ void DatabaseModel::disconnectRelationships(void)
 	}
 }
 
+void DatabaseModel::disconnectRelationships(const vector<BaseObject *> &rels)
+{
+	try
+	{
+		vector<BaseObject *>::const_reverse_iterator ritr_rel;
+
+		//The relationships must be disconnected from the last to the first
+		for(ritr_rel=rels.rbegin(); ritr_rel!=rels.rend(); ritr_rel++)
+		{
+			if((*ritr_rel)->getObjectType()==OBJ_RELATIONSHIP)
+				dynamic_cast<Relationship *>(*ritr_rel)->disconnectRelationship();
+			else
+				dynamic_cast<BaseRelationship *>(*ritr_rel)->disconnectRelationship();
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+	}
+}
+
+vector<BaseObject *> DatabaseModel::getLinkedRelationships(const vector<BaseObject *> &rels)
+{
+	map<BaseTable *, vector<BaseTable *>> linked_tabs;
+	set<BaseTable *> visited_tabs;
+	vector<BaseTable *> tabs;
+	vector<BaseObject *> linked_rels;
+	BaseRelationship *base_rel=nullptr;
+	BaseTable *src_tab=nullptr, *dst_tab=nullptr, *tab=nullptr;
+
+	//Creating the adjacency list of the tables linked by table-table relationships
+	for(auto &obj : relationships)
+	{
+		base_rel=dynamic_cast<BaseRelationship *>(obj);
+
+		if(base_rel->getObjectType()==OBJ_RELATIONSHIP)
+		{
+			src_tab=base_rel->getTable(BaseRelationship::SRC_TABLE);
+			dst_tab=base_rel->getTable(BaseRelationship::DST_TABLE);
+			linked_tabs[src_tab].push_back(dst_tab);
+			linked_tabs[dst_tab].push_back(src_tab);
+		}
+	}
+
+	for(auto &obj : rels)
+	{
+		base_rel=dynamic_cast<BaseRelationship *>(obj);
+		tabs.push_back(base_rel->getTable(BaseRelationship::SRC_TABLE));
+		tabs.push_back(base_rel->getTable(BaseRelationship::DST_TABLE));
+	}
+
+	//Visiting all the tables that can be reached from the ones linked by the passed relationships
+	while(!tabs.empty())
+	{
+		tab=tabs.back();
+		tabs.pop_back();
+
+		if(visited_tabs.insert(tab).second)
+			tabs.insert(tabs.end(), linked_tabs[tab].begin(), linked_tabs[tab].end());
+	}
+
+	for(auto &obj : relationships)
+	{
+		base_rel=dynamic_cast<BaseRelationship *>(obj);
+
+		if(base_rel->getObjectType()==OBJ_RELATIONSHIP &&
+			 visited_tabs.count(base_rel->getTable(BaseRelationship::SRC_TABLE)))
+			linked_rels.push_back(obj);
+	}
+
+	return(linked_rels);
+}
+
 void DatabaseModel::validateRelationships(void)
 {
 	vector<BaseObject *>::iterator itr, itr_end, itr_ant;
 	Relationship *rel=nullptr;
 	BaseRelationship *base_rel=nullptr;
 	vector<BaseObject *> vet_rel, vet_rel_inv, rels, fail_rels;
-	bool found_inval_rel, valid_fail_rels=false;
+	set<BaseObject *> inval_rels;
+	bool found_inval_rel, valid_fail_rels=false, full_validation=false;
 	vector<Exception> errors;
 	map<unsigned, QString>::iterator itr1, itr1_end;
 	map<unsigned, Exception> error_map;
@@ -1388,8 +1513,35 @@ void DatabaseModel::validateRelationships(void)
 
 			if(found_inval_rel)
 			{
-				//Disconnects all the relationship
-				disconnectRelationships();
+				/* Only the relationships linked (directly or not) to the invalidated ones are reconnected since
+				the tables outside that portion of the model aren't affected by the propagation of columns */
+				if(!full_validation)
+				{
+					rels=getLinkedRelationships(vet_rel_inv);
+					full_validation=(rels.size()==relationships.size());
+				}
+
+				if(full_validation)
+				{
+					//Disconnects all the relationship
+					disconnectRelationships();
+				}
+				else
+				{
+					disconnectRelationships(rels);
+
+					//Keeps only the valid relationships that will be reconnected together with the invalidated ones
+					inval_rels.insert(vet_rel_inv.begin(), vet_rel_inv.end());
+					vet_rel.clear();
+
+					for(auto &rel_obj : rels)
+					{
+						if(!inval_rels.count(rel_obj))
+							vet_rel.push_back(rel_obj);
+					}
+
+					inval_rels.clear();
+				}
 
 				/* Merges the two lists (valid and invalid relationships),
 					 taking care to insert the invalid ones at the end of the list */
@@ -1507,7 +1659,17 @@ void DatabaseModel::validateRelationships(void)
 					}
 				}
 
-				itr=rels.begin();
+				if(full_validation)
+					itr=rels.begin();
+				else
+				{
+					/* After a partial validation the whole relationship list is checked again and, in case
+					of some relationship still invalidated, all of them will be validated (fallback) */
+					full_validation=true;
+					rels=relationships;
+					itr=rels.begin();
+					itr_end=rels.end();
+				}
 			}
 
 			//Recreating the special objects
@@ -1978,8 +2140,10 @@ void DatabaseModel::removeRelationship(BaseRelationship *rel, int obj_idx)
 				if(rel->getRelationshipType()!=Relationship::RELATIONSHIP_NN)
 					recv_tab=dynamic_cast<Relationship *>(rel)->getReceiverTable();
 
+				/* Disconnects only the relationships linked to the one being removed, the remaining ones
+				will be reconnected in the validation since they'll be invalidated */
 				storeSpecialObjectsXML();
-				disconnectRelationships();
+				disconnectRelationships(getLinkedRelationships({ rel }));
 			}
 			else if(rel->getObjectType()==BASE_RELATIONSHIP)
 			{
@@ -2703,6 +2867,7 @@ void DatabaseModel::addPermission(Permission *perm)
 
 		permissions.push_back(perm);
 		perm->setDatabase(this);
+		indexObjectReferences(perm);
 	}
 	catch(Exception &e)
 	{
@@ -2748,6 +2913,7 @@ void DatabaseModel::removePermissions(BaseObject *object)
 
 		if(perm->getObject()==object)
 		{
+			unindexObjectReferences(perm);
 			permissions.erase(itr);
 			itr=itr_end=permissions.end();
 
@@ -2854,8 +3020,40 @@ int DatabaseModel::getPermissionIndex(Permission *perm, bool exact_match)
 
 BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type)
 {
-	int idx;
-	return(getObject(name, obj_type, idx));
+	BaseObject *object=nullptr;
+	vector<BaseObject *> *obj_list=getObjectList(obj_type);
+	QString aux_name1;
+
+	if(!obj_list)
+		throw Exception(ERR_OBT_OBJ_INVALID_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	aux_name1=QString(name).remove('"');
+
+	if(obj_type!=OBJ_PERMISSION)
+	{
+		object=getLookupIndex(obj_type).value(aux_name1);
+
+		/* If the object found doesn't have the searched signature anymore the index is
+		 outdated (some signature change wasn't notified) so it's rebuilt */
+		if(object && object->getSignature().remove('"')!=aux_name1)
+		{
+			obj_indexes.erase(obj_type);
+			object=getLookupIndex(obj_type).value(aux_name1);
+		}
+	}
+	else
+	{
+		for(auto &obj : *obj_list)
+		{
+			if(obj->getSignature().remove('"')==aux_name1)
+			{
+				object=obj;
+				break;
+			}
+		}
+	}
+
+	return(object);
 }
 
 int DatabaseModel::getObjectIndex(const QString &name, ObjectType obj_type)
@@ -2945,8 +3143,9 @@ void DatabaseModel::loadModel(const QString &filename)
 								 GlobalAttributes::OBJECT_DTD_EXT,
 								 GlobalAttributes::ROOT_DTD);
 
-			//Loads the file validating it against the root DTD
-			xmlparser.loadXMLFile(filename);
+			/* Opens the file in streaming mode validating it against the root DTD. Each object's element
+			is read only when needed so the whole document is never held in memory */
+			xmlparser.openXMLStream(filename);
 
 			//Gets the basic model information
 			xmlparser.getElementAttributes(attribs);
@@ -2968,61 +3167,56 @@ void DatabaseModel::loadModel(const QString &filename)
 			def_objs[OBJ_COLLATION]=attribs[ParsersAttributes::DEFAULT_COLLATION];
 			def_objs[OBJ_TABLESPACE]=attribs[ParsersAttributes::DEFAULT_TABLESPACE];
 
-			if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+			while(xmlparser.accessNextStreamElement())
 			{
-				do
+				elem_name=xmlparser.getElementName();
+
+				//Indentifies the object type to be load according to the current element on the parser
+				obj_type=getObjectType(elem_name);
+
+				if(obj_type==OBJ_DATABASE)
+				{
+					xmlparser.getElementAttributes(attribs);
+					configureDatabase(attribs);
+				}
+				else
 				{
-					if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+					try
 					{
-						elem_name=xmlparser.getElementName();
-
-						//Indentifies the object type to be load according to the current element on the parser
-						obj_type=getObjectType(elem_name);
+						//Saves the current position of the parser before create any object
+						xmlparser.savePosition();
+						object=createObject(obj_type);
 
-						if(obj_type==OBJ_DATABASE)
+						if(object)
 						{
-							xmlparser.getElementAttributes(attribs);
-							configureDatabase(attribs);
+							if(!dynamic_cast<TableObject *>(object) && obj_type!=OBJ_RELATIONSHIP && obj_type!=BASE_RELATIONSHIP)
+								addObject(object);
+
+							/* If there is at least one inheritance relationship we need to flag this situation
+							 in order to do an addtional rel. validation in the end of loading */
+							if(!found_inh_rel && object->getObjectType()==OBJ_RELATIONSHIP &&
+									dynamic_cast<Relationship *>(object)->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN)
+								found_inh_rel=true;
+
+							emit s_objectLoaded(xmlparser.getReadingProgress(),
+												trUtf8("Loading: `%1' (%2)")
+												.arg(object->getName())
+												.arg(object->getTypeName()),
+												obj_type);
 						}
-						else
-						{
-							try
-							{
-								//Saves the current position of the parser before create any object
-								xmlparser.savePosition();
-								object=createObject(obj_type);
 
-								if(object)
-								{
-									if(!dynamic_cast<TableObject *>(object) && obj_type!=OBJ_RELATIONSHIP && obj_type!=BASE_RELATIONSHIP)
-										addObject(object);
-
-									/* If there is at least one inheritance relationship we need to flag this situation
-									 in order to do an addtional rel. validation in the end of loading */
-									if(!found_inh_rel && object->getObjectType()==OBJ_RELATIONSHIP &&
-											dynamic_cast<Relationship *>(object)->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN)
-										found_inh_rel=true;
-
-									emit s_objectLoaded((xmlparser.getCurrentBufferLine()/static_cast<float>(xmlparser.getBufferLineCount()))*100,
-														trUtf8("Loading: `%1' (%2)")
-														.arg(object->getName())
-														.arg(object->getTypeName()),
-														obj_type);
-								}
-
-								xmlparser.restorePosition();
-							}
-							catch(Exception &e)
-							{
-								QString info_adicional=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
-								throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, info_adicional);
-							}
-						}
+						xmlparser.restorePosition();
+					}
+					catch(Exception &e)
+					{
+						QString info_adicional=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
+						throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, info_adicional);
 					}
 				}
-				while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 			}
 
+			xmlparser.restartParser();
+
 			this->BaseObject::setProtected(protected_model);
 
 			//Validating default objects
@@ -6344,7 +6538,18 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 			if(revalidate_rels || ref_tab_inheritance)
 			{
 				storeSpecialObjectsXML();
-				disconnectRelationships();
+
+				/* Instead of disconnecting all the relationships only the ones connected to the parent table are
+				invalidated so the validation will reconnect only the portion of the model linked to that table */
+				for(auto &obj : relationships)
+				{
+					rel=dynamic_cast<Relationship *>(obj);
+
+					if(rel->getTable(BaseRelationship::SRC_TABLE)==parent_tab ||
+						 rel->getTable(BaseRelationship::DST_TABLE)==parent_tab)
+						rel->forceInvalidate();
+				}
+
 				validateRelationships();
 			}
 		}
@@ -6432,17 +6637,96 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type)
 
 QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 {
+	QString def;
+	QTextStream out(&def);
+
+	writeCodeDefinition(out, def_type, export_file);
+	out.flush();
+
+	return(def);
+}
+
+void DatabaseModel::writeCodeDefinition(QIODevice *output, unsigned def_type, bool export_file)
+{
+	if(!output || !output->isWritable())
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	QTextStream out(output);
+
+	out.setCodec("UTF-8");
+	writeCodeDefinition(out, def_type, export_file);
+	out.flush();
+}
+
+void DatabaseModel::writeCodeDefinition(QTextStream &out, unsigned def_type, bool export_file)
+{
+	writeCodeDefinition([&](BaseObject *, const QString &code){ out << code; }, def_type, export_file);
+}
+
+void DatabaseModel::writeCodeDefinition(const function<void(BaseObject *, const QString &)> &write_code, unsigned def_type, bool export_file)
+{
+	/* Number of objects that have their code generated (in parallel when possible) and
+	written before the next ones are generated. This limits the amount of code held in memory */
+	static const unsigned CHUNK_SIZE=256;
+
 	attribs_map attribs_aux;
-	unsigned general_obj_cnt, gen_defs_count;
-	bool sql_disabled=false;
+	unsigned general_obj_cnt, gen_defs_count, chunk_end;
 	BaseObject *object=nullptr;
 	QString def, search_path=QString("pg_catalog,public"),
 			msg=trUtf8("Generating %1 of the object `%2' (%3)"),
 			attrib=ParsersAttributes::OBJECTS, attrib_aux,
-			def_type_str=(def_type==SchemaParser::SQL_DEFINITION ? QString("SQL") : QString("XML"));
+			def_type_str=(def_type==SchemaParser::SQL_DEFINITION ? QString("SQL") : QString("XML")),
+			objs_mark=QString("%1%2%1").arg(QChar(0x01)).arg(ParsersAttributes::OBJECTS),
+			perms_mark=QString("%1%2%1").arg(QChar(0x01)).arg(ParsersAttributes::PERMISSION),
+			hdr_mark=QString("%1%2%1").arg(QChar(0x01));
 	Type *usr_type=nullptr;
 	map<unsigned, BaseObject *> objects_map;
+	map<BaseObject *, QString> par_defs;
 	ObjectType obj_type;
+	vector<BaseObject *> header_objs, body_objs, perms, chunk;
+	vector<QString> header_defs;
+	int objs_pos=-1, perms_pos=-1;
+
+	auto emitProgress=[&](BaseObject *obj){
+		gen_defs_count++;
+
+		if((def_type==SchemaParser::SQL_DEFINITION && !obj->isSQLDisabled()) ||
+				(def_type==SchemaParser::XML_DEFINITION && !obj->isSystemObject()))
+		{
+			emit s_objectLoaded((gen_defs_count/static_cast<unsigned>(general_obj_cnt)) * 100,
+								msg.arg(def_type_str)
+								.arg(obj->getName())
+								.arg(obj->getTypeName()),
+								obj->getObjectType());
+		}
+	};
+
+	/* The XML code of the whole model has the special chars converted once more after being
+	generated by the parser, so the same is done here with each object's code written separately */
+	auto writeObjectCode=[&](BaseObject *obj, const QString &code){
+		if(def_type==SchemaParser::XML_DEFINITION)
+			write_code(obj, SchemaParser::convertCharsToXMLEntities(code));
+		else
+			write_code(obj, code);
+	};
+
+	/* Writes a piece of the model's code replacing the marks placed in it by the code
+	of the header objects (see below) so each object's code is written along with the object */
+	auto writeModelCode=[&](const QString &code){
+		int start=0, mark_pos=-1, mark_end=-1, obj_idx=-1;
+
+		while((mark_pos=code.indexOf(QChar(0x01), start)) >= 0)
+		{
+			mark_end=code.indexOf(QChar(0x01), mark_pos + 1);
+			obj_idx=code.mid(mark_pos + 1, mark_end - mark_pos - 1).toInt();
+
+			write_code(nullptr, code.mid(start, mark_pos - start));
+			write_code(header_objs[obj_idx], header_defs[obj_idx]);
+			start=mark_end + 1;
+		}
+
+		write_code(nullptr, code.mid(start));
+	};
 
 	try
 	{
@@ -6451,7 +6735,6 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 		gen_defs_count=0;
 
 		attribs_aux[ParsersAttributes::SHELL_TYPES]=QString();
-		attribs_aux[ParsersAttributes::PERMISSION]=QString();
 		attribs_aux[ParsersAttributes::SCHEMA]=QString();
 		attribs_aux[ParsersAttributes::TABLESPACE]=QString();
 		attribs_aux[ParsersAttributes::ROLE]=QString();
@@ -6469,108 +6752,42 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 			}
 		}
 
+		/* Separating the objects which code is placed in the header of the model's code (roles, tablespaces, schemas, the database
+		and shell types) from the ones which code is written as soon as it's generated (objects and permissions) */
 		for(auto &obj_itr : objects_map)
 		{
 			object=obj_itr.second;
 			obj_type=object->getObjectType();
 
-			if(obj_type==OBJ_TYPE && def_type==SchemaParser::SQL_DEFINITION)
-			{
-				usr_type=dynamic_cast<Type *>(object);
-
-				//Generating the shell type declaration (only for base types)
-				if(usr_type->getConfiguration()==Type::BASE_TYPE)
-					attribs_aux[ParsersAttributes::SHELL_TYPES]+=usr_type->getCodeDefinition(def_type, true);
-				else
-					attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
-			}
-			else if(obj_type==OBJ_DATABASE)
-			{
-				if(def_type==SchemaParser::SQL_DEFINITION)
-				{
-					/* The Database has the SQL code definition disabled when generating the
-		  code of the entire model because this object cannot be created from a multiline sql command */
-
-					//Saving the sql disabled state
-					sql_disabled=this->isSQLDisabled();
-
-					//Disables the sql to generate a commented code
-					this->setSQLDisabled(true);
-					attribs_aux[this->getSchemaName()]+=this->__getCodeDefinition(def_type);
-
-					//Restore the original sql disabled state
-					this->setSQLDisabled(sql_disabled);
-				}
-				else
-					attribs_aux[attrib]+=this->__getCodeDefinition(def_type);
-			}
-			else if(obj_type==OBJ_PERMISSION)
-			{
-				attribs_aux[ParsersAttributes::PERMISSION]+=dynamic_cast<Permission *>(object)->getCodeDefinition(def_type);
-			}
-			else if(obj_type==OBJ_CONSTRAINT)
-			{
-				attribs_aux[attrib]+=dynamic_cast<Constraint *>(object)->getCodeDefinition(def_type, true);
-			}
-			else if(obj_type==OBJ_ROLE || obj_type==OBJ_TABLESPACE ||  obj_type==OBJ_SCHEMA)
-			{
-				//The "public" schema does not have the SQL code definition generated
-				if(def_type==SchemaParser::SQL_DEFINITION)
-					attrib_aux=BaseObject::getSchemaName(obj_type);
-				else
-					attrib_aux=attrib;
-
-				/* The Tablespace has the SQL code definition disabled when generating the
-		  code of the entire model because this object cannot be created from a multiline sql command */
-				if(obj_type==OBJ_TABLESPACE && !object->isSystemObject() && def_type==SchemaParser::SQL_DEFINITION)
-				{
-					//Saving the sql disabled state
-					sql_disabled=object->isSQLDisabled();
-
-					//Disables the sql to generate a commented code
-					object->setSQLDisabled(true);
-					attribs_aux[attrib_aux]+=object->getCodeDefinition(def_type);
-
-					//Restore the original sql disabled state
-					object->setSQLDisabled(sql_disabled);
-				}
-				//System object doesn't has the XML generated (the only exception is for public schema)
-				else if((obj_type!=OBJ_SCHEMA && !object->isSystemObject()) ||
-						(obj_type==OBJ_SCHEMA &&
-						 ((object->getName()==QString("public") && def_type==SchemaParser::XML_DEFINITION) ||
-						  (object->getName()!=QString("public") && object->getName()!=QString("pg_catalog")))))
-				{
-					if(object->getObjectType()==OBJ_SCHEMA)
-						search_path+=QString(",") + object->getName(true);
-
-					//Generates the code definition and concatenates to the others
-					attribs_aux[attrib_aux]+=object->getCodeDefinition(def_type);
-				}
-			}
+			if(obj_type==OBJ_PERMISSION)
+				perms.push_back(object);
+			else if(def_type==SchemaParser::SQL_DEFINITION &&
+							(obj_type==OBJ_ROLE || obj_type==OBJ_TABLESPACE ||  obj_type==OBJ_SCHEMA || obj_type==OBJ_DATABASE ||
+							 (obj_type==OBJ_TYPE && dynamic_cast<Type *>(object)->getConfiguration()==Type::BASE_TYPE)))
+				header_objs.push_back(object);
 			else
-			{
-				if(object->isSystemObject())
-					attribs_aux[attrib]+=QString();
-				else
-					attribs_aux[attrib]+=object->getCodeDefinition(def_type);
-			}
+				body_objs.push_back(object);
+		}
+
+		/* The code of the header objects is placed in the model's code through marks, replaced by the
+		objects' code when writing the model's code. This way the writer knows which object generated each piece of code */
+		for(auto &obj : header_objs)
+		{
+			def=getModelObjectCode(obj, def_type, attrib_aux, search_path);
 
-			gen_defs_count++;
+			if(!def.isEmpty())
+				attribs_aux[attrib_aux]+=hdr_mark.arg(header_defs.size());
 
-			if((def_type==SchemaParser::SQL_DEFINITION && !object->isSQLDisabled()) ||
-					(def_type==SchemaParser::XML_DEFINITION && !object->isSystemObject()))
-			{
-				emit s_objectLoaded((gen_defs_count/static_cast<unsigned>(general_obj_cnt)) * 100,
-									msg.arg(def_type_str)
-									.arg(object->getName())
-									.arg(object->getTypeName()),
-									object->getObjectType());
-			}
+			header_defs.push_back(def);
+			emitProgress(obj);
 		}
 
+		attribs_aux[ParsersAttributes::OBJECTS]=objs_mark;
+		attribs_aux[ParsersAttributes::PERMISSION]=perms_mark;
 		attribs_aux[ParsersAttributes::SEARCH_PATH]=search_path;
 		attribs_aux[ParsersAttributes::MODEL_AUTHOR]=author;
 		attribs_aux[ParsersAttributes::PGMODELER_VERSION]=GlobalAttributes::PGMODELER_VERSION;
+		attribs_aux[ParsersAttributes::EXPORT_TO_FILE]=(export_file ? ParsersAttributes::_TRUE_ : QString());
 
 		if(def_type==SchemaParser::XML_DEFINITION)
 		{
@@ -6582,18 +6799,67 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 			attribs_aux[ParsersAttributes::DEFAULT_TABLESPACE]=(default_objs[OBJ_TABLESPACE] ? default_objs[OBJ_TABLESPACE]->getName(true) : QString());
 			attribs_aux[ParsersAttributes::DEFAULT_COLLATION]=(default_objs[OBJ_COLLATION] ? default_objs[OBJ_COLLATION]->getName(true) : QString());
 		}
-		else
+
+		/* The model's code is generated with marks in place of the objects and permissions. The code before
+		each mark is written and then the code of the objects/permissions, one at time, in creation order */
+		def=schparser.getCodeDefinition(ParsersAttributes::DB_MODEL, attribs_aux, def_type);
+		objs_pos=def.indexOf(objs_mark);
+		perms_pos=def.indexOf(perms_mark);
+
+		if(objs_pos < 0 || perms_pos < objs_pos)
+			throw Exception(Exception::getErrorMessage(ERR_ASG_OBJ_INV_DEFINITION).arg(this->getName()).arg(this->getTypeName()),
+											ERR_ASG_OBJ_INV_DEFINITION,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		if(prepend_at_bod && def_type==SchemaParser::SQL_DEFINITION)
+			write_code(nullptr, QString("-- Prepended SQL commands --\n") + this->prepended_sql + QString("\n---\n\n"));
+
+		writeModelCode(def.left(objs_pos));
+
+		for(unsigned chunk_start=0; chunk_start < body_objs.size(); chunk_start+=CHUNK_SIZE)
+		{
+			chunk_end=std::min<unsigned>(chunk_start + CHUNK_SIZE, body_objs.size());
+			chunk.assign(body_objs.begin() + chunk_start, body_objs.begin() + chunk_end);
+			generateCodeInParallel(chunk, def_type, par_defs);
+
+			for(auto &obj : chunk)
+			{
+				if(par_defs.count(obj))
+					writeObjectCode(obj, par_defs[obj]);
+				else
+					writeObjectCode(obj, getModelObjectCode(obj, def_type, attrib_aux, search_path));
+
+				emitProgress(obj);
+			}
+
+			par_defs.clear();
+		}
+
+		if(def_type==SchemaParser::SQL_DEFINITION)
 		{
 			for(auto &type : types)
 			{
 				usr_type=dynamic_cast<Type *>(type);
 				if(usr_type->getConfiguration()==Type::BASE_TYPE)
 				{
-					attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
+					write_code(usr_type, usr_type->getCodeDefinition(def_type));
 					usr_type->convertFunctionParameters(true);
 				}
 			}
 		}
+
+		objs_pos+=objs_mark.size();
+		writeModelCode(def.mid(objs_pos, perms_pos - objs_pos));
+
+		for(auto &perm : perms)
+		{
+			writeObjectCode(perm, dynamic_cast<Permission *>(perm)->getCodeDefinition(def_type));
+			emitProgress(perm);
+		}
+
+		writeModelCode(def.mid(perms_pos + perms_mark.size()));
+
+		if(append_at_eod && def_type==SchemaParser::SQL_DEFINITION)
+			write_code(nullptr, QString("-- Appended SQL commands --\n") + this->appended_sql + QString("\n---\n"));
 	}
 	catch(Exception &e)
 	{
@@ -6603,27 +6869,332 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 			{
 				usr_type=dynamic_cast<Type *>(type);
 				if(usr_type->getConfiguration()==Type::BASE_TYPE)
-				{
-					attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
 					usr_type->convertFunctionParameters(true);
-				}
 			}
 		}
 		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
+}
 
-	attribs_aux[ParsersAttributes::EXPORT_TO_FILE]=(export_file ? ParsersAttributes::_TRUE_ : QString());
-	def=schparser.getCodeDefinition(ParsersAttributes::DB_MODEL, attribs_aux, def_type);
+vector<DatabaseModel::SQLStatement> DatabaseModel::getSQLStatements(bool incl_drop_cmds)
+{
+	vector<SQLStatement> stmts;
+
+	try
+	{
+		writeCodeDefinition([&](BaseObject *object, const QString &code){
+			splitSQLStatements(code, object, incl_drop_cmds, stmts);
+		}, SchemaParser::SQL_DEFINITION, false);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+
+	return(stmts);
+}
+
+void DatabaseModel::splitSQLStatements(const QString &code, BaseObject *object, bool incl_drop_cmds, vector<SQLStatement> &stmts)
+{
+	static const QString obj_hdr=QString("object: "), type_hdr=QString(" | type: "), comm_tk=QString("--");
+	static const QStringList cmd_modifiers={ QString("OR REPLACE "), QString("UNIQUE "), QString("MATERIALIZED "),
+											 QString("RECURSIVE "), QString("UNLOGGED ") },
+			name_modifiers={ QString("IF NOT EXISTS "), QString("IF EXISTS "), QString("CONCURRENTLY ") };
+
+	//Maps the SQL names of the object types (as found in the object headers and commands) to the types themselves
+	static const map<QString, ObjectType> sql_types=[](){
+		map<QString, ObjectType> types;
+
+		for(auto &type : BaseObject::getObjectTypes(true))
+		{
+			if(!BaseObject::getSQLName(type).isEmpty())
+				types[BaseObject::getSQLName(type)]=type;
+		}
+
+		return(types);
+	}();
+
+	int start=0, end=0, type_pos=-1, comm_cnt=0;
+	QString sql, hdr_name, hdr_type;
+	SQLStatement stmt;
+
+	/* Configures the type and name of the object related to the statement. The object that generated the code is
+	used when available, except for table children created via ALTER TABLE which are identified by their headers.
+	Statements without an object (e.g. from a raw buffer) are identified by the header or by the command's keywords */
+	auto pushStatement=[&](const QString &sql, bool is_drop){
+		QString lin, kw, sql_name;
+
+		stmt.object=object;
+		stmt.sql=sql;
+		stmt.is_drop=is_drop;
+		stmt.obj_type=BASE_OBJECT;
+		stmt.obj_name.clear();
+
+		if(!hdr_type.isEmpty() && sql_types.count(hdr_type) &&
+			 (!object || (object->getObjectType()==OBJ_TABLE && hdr_type!=object->getSQLName())))
+		{
+			stmt.obj_type=sql_types.at(hdr_type);
+			stmt.obj_name=(object ? object->getSignature() + QString(".") + hdr_name : hdr_name);
+		}
+		else if(object)
+		{
+			stmt.obj_type=object->getObjectType();
+			stmt.obj_name=object->getSignature();
+		}
+		else
+		{
+			lin=sql.trimmed();
+			lin=lin.left(lin.indexOf('\n')).simplified();
+			kw=lin.section(' ', 0, 0);
+
+			if(kw==QString("CREATE") || kw==QString("ALTER") || kw==QString("DROP"))
+			{
+				lin.remove(0, kw.size() + 1);
+
+				for(auto &mod : cmd_modifiers)
+				{
+					if(lin.startsWith(mod))
+						lin.remove(0, mod.size());
+				}
+
+				//Using the longest SQL name matched in order to distinguish OPERATOR from OPERATOR CLASS, for instance
+				for(auto &itr : sql_types)
+				{
+					if(itr.first.size() > sql_name.size() && lin.startsWith(itr.first + QChar(' ')))
+						sql_name=itr.first;
+				}
+
+				if(!sql_name.isEmpty())
+				{
+					stmt.obj_type=sql_types.at(sql_name);
+					lin.remove(0, sql_name.size() + 1);
+
+					for(auto &mod : name_modifiers)
+					{
+						if(lin.startsWith(mod))
+							lin.remove(0, mod.size());
+					}
+
+					if(stmt.obj_type==OBJ_CAST)
+						stmt.obj_name=QString("cast") + lin.left(lin.indexOf(')') + 1).replace(QString(" AS "), QString(","));
+					else
+					{
+						stmt.obj_name=lin.section(' ', 0, 0);
+
+						if(stmt.obj_type!=OBJ_FUNCTION && stmt.obj_type!=OBJ_AGGREGATE)
+							stmt.obj_name=stmt.obj_name.left(stmt.obj_name.indexOf('('));
+					}
+
+					stmt.obj_name.remove('"');
+					stmt.obj_name.remove(';');
+				}
+			}
+		}
+
+		stmts.push_back(stmt);
+	};
+
+	//Each statement in the code is delimited by the ddl end token
+	while(start < code.size())
+	{
+		end=code.indexOf(ParsersAttributes::DDL_END_TOKEN, start);
+
+		if(end < 0)
+			end=code.size();
+
+		sql.clear();
+		hdr_name.clear();
+		hdr_type.clear();
+
+		for(QString lin : code.mid(start, end - start).split('\n'))
+		{
+			if(lin.startsWith(comm_tk))
+			{
+				comm_cnt=lin.count(comm_tk);
+				lin=lin.remove(comm_tk).trimmed();
+
+				//Object headers (-- object: [name] | type: [type] --) identify the object created by the statement
+				if(lin.startsWith(obj_hdr) && (type_pos=lin.indexOf(type_hdr)) >= 0)
+				{
+					hdr_name=lin.mid(obj_hdr.size(), type_pos - obj_hdr.size()).trimmed();
+					hdr_type=lin.mid(type_pos + type_hdr.size()).trimmed();
+				}
+				/* DROP commands (DROP [OBJECT] or ALTER TABLE...DROP) are placed commented in the code. When the comment
+				token appears only once the object related to the DROP is enabled so the command can be executed */
+				else if(incl_drop_cmds && comm_cnt==1 &&
+								(lin.startsWith(QString("DROP ")) ||
+								 (lin.startsWith(QString("ALTER TABLE ")) && lin.contains(QString(" DROP ")))))
+					pushStatement(lin + QString("\n"), true);
+			}
+			else if(!lin.isEmpty())
+				sql+=lin + QString("\n");
+		}
+
+		if(!sql.trimmed().isEmpty())
+			pushStatement(sql, false);
 
-	if(prepend_at_bod && def_type==SchemaParser::SQL_DEFINITION)
-		def=QString("-- Prepended SQL commands --\n") +	this->prepended_sql + QString("\n---\n\n") + def;
+		start=end + ParsersAttributes::DDL_END_TOKEN.size();
+	}
+}
+
+QString DatabaseModel::getModelObjectCode(BaseObject *object, unsigned def_type, QString &attrib, QString &search_path)
+{
+	ObjectType obj_type=object->getObjectType();
+	QString def;
+	bool sql_disabled=false;
+
+	attrib=ParsersAttributes::OBJECTS;
+
+	if(obj_type==OBJ_TYPE && def_type==SchemaParser::SQL_DEFINITION)
+	{
+		Type *usr_type=dynamic_cast<Type *>(object);
+
+		//Generating the shell type declaration (only for base types)
+		if(usr_type->getConfiguration()==Type::BASE_TYPE)
+		{
+			attrib=ParsersAttributes::SHELL_TYPES;
+			def=usr_type->getCodeDefinition(def_type, true);
+		}
+		else
+			def=usr_type->getCodeDefinition(def_type);
+	}
+	else if(obj_type==OBJ_DATABASE)
+	{
+		if(def_type==SchemaParser::SQL_DEFINITION)
+		{
+			/* The Database has the SQL code definition disabled when generating the
+			code of the entire model because this object cannot be created from a multiline sql command */
+
+			//Saving the sql disabled state
+			sql_disabled=this->isSQLDisabled();
+
+			//Disables the sql to generate a commented code
+			this->setSQLDisabled(true);
+			attrib=this->getSchemaName();
+			def=this->__getCodeDefinition(def_type);
+
+			//Restore the original sql disabled state
+			this->setSQLDisabled(sql_disabled);
+		}
+		else
+			def=this->__getCodeDefinition(def_type);
+	}
+	else if(obj_type==OBJ_PERMISSION)
+	{
+		attrib=ParsersAttributes::PERMISSION;
+		def=dynamic_cast<Permission *>(object)->getCodeDefinition(def_type);
+	}
+	else if(obj_type==OBJ_CONSTRAINT)
+	{
+		def=dynamic_cast<Constraint *>(object)->getCodeDefinition(def_type, true);
+	}
+	else if(obj_type==OBJ_ROLE || obj_type==OBJ_TABLESPACE ||  obj_type==OBJ_SCHEMA)
+	{
+		//The "public" schema does not have the SQL code definition generated
+		if(def_type==SchemaParser::SQL_DEFINITION)
+			attrib=BaseObject::getSchemaName(obj_type);
+
+		/* The Tablespace has the SQL code definition disabled when generating the
+		code of the entire model because this object cannot be created from a multiline sql command */
+		if(obj_type==OBJ_TABLESPACE && !object->isSystemObject() && def_type==SchemaParser::SQL_DEFINITION)
+		{
+			//Saving the sql disabled state
+			sql_disabled=object->isSQLDisabled();
 
-	if(append_at_eod && def_type==SchemaParser::SQL_DEFINITION)
-		def+=QString("-- Appended SQL commands --\n") +	this->appended_sql + QString("\n---\n");
+			//Disables the sql to generate a commented code
+			object->setSQLDisabled(true);
+			def=object->getCodeDefinition(def_type);
+
+			//Restore the original sql disabled state
+			object->setSQLDisabled(sql_disabled);
+		}
+		//System object doesn't has the XML generated (the only exception is for public schema)
+		else if((obj_type!=OBJ_SCHEMA && !object->isSystemObject()) ||
+				(obj_type==OBJ_SCHEMA &&
+				 ((object->getName()==QString("public") && def_type==SchemaParser::XML_DEFINITION) ||
+					(object->getName()!=QString("public") && object->getName()!=QString("pg_catalog")))))
+		{
+			if(object->getObjectType()==OBJ_SCHEMA)
+				search_path+=QString(",") + object->getName(true);
+
+			//Generates the code definition and concatenates to the others
+			def=object->getCodeDefinition(def_type);
+		}
+	}
+	else if(!object->isSystemObject())
+		def=object->getCodeDefinition(def_type);
 
 	return(def);
 }
 
+void DatabaseModel::generateCodeInParallel(const vector<BaseObject *> &objects, unsigned def_type, map<BaseObject *, QString> &codes)
+{
+	vector<BaseObject *> par_objs;
+	vector<QString> par_defs;
+	vector<Exception> par_errors;
+	vector<unsigned char> par_failed;
+	vector<unsigned> idxs;
+
+	for(auto &obj : objects)
+	{
+		if(isParallelCodeGenAllowed(obj, def_type))
+		{
+			idxs.push_back(par_objs.size());
+			par_objs.push_back(obj);
+		}
+	}
+
+	if(par_objs.empty())
+		return;
+
+	par_defs.resize(par_objs.size());
+	par_errors.resize(par_objs.size());
+	par_failed.resize(par_objs.size(), 0);
+
+	/* Each object uses its own schema parser so there's no need to synchronize the workers.
+	The generated code is written afterwards by the caller respecting the creation order */
+	QtConcurrent::blockingMap(idxs, [&](unsigned idx){
+		BaseObject *obj=par_objs[idx];
+
+		try
+		{
+			if(obj->getObjectType()==OBJ_CONSTRAINT)
+				par_defs[idx]=dynamic_cast<Constraint *>(obj)->getCodeDefinition(def_type, true);
+			else
+				par_defs[idx]=obj->getCodeDefinition(def_type);
+		}
+		catch(Exception &e)
+		{
+			par_errors[idx]=e;
+			par_failed[idx]=1;
+		}
+	});
+
+	for(unsigned idx=0; idx < par_objs.size(); idx++)
+	{
+		if(par_failed[idx])
+			throw Exception(par_errors[idx].getErrorMessage(), par_errors[idx].getErrorType(),
+											__PRETTY_FUNCTION__,__FILE__,__LINE__, &par_errors[idx]);
+
+		codes[par_objs[idx]]=par_defs[idx];
+	}
+}
+
+bool DatabaseModel::isParallelCodeGenAllowed(BaseObject *object, unsigned def_type)
+{
+	ObjectType obj_type=object->getObjectType();
+	Constraint *constr=dynamic_cast<Constraint *>(object);
+
+	/* XML code is always generated sequentially since the objects include the reduced form
+	of the shared ones (schema, owner, tablespace, tags) and that would modify the shared objects concurrently */
+	if(def_type!=SchemaParser::SQL_DEFINITION || object->isSystemObject())
+		return(false);
+
+	return(obj_type==OBJ_TABLE || obj_type==OBJ_VIEW ||
+				 obj_type==OBJ_SEQUENCE || obj_type==OBJ_DOMAIN ||
+				 (constr && constr->getConstraintType()==ConstraintType::foreign_key));
+}
+
 map<unsigned, BaseObject *> DatabaseModel::getCreationOrder(unsigned def_type, bool incl_relnn_objs, bool incl_rel1n_constrs)
 {
 	BaseObject *object=nullptr;
@@ -7085,8 +7656,9 @@ vector<BaseObject *> DatabaseModel::getCreationOrder(BaseObject *object, bool on
 
 void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
 {
-	QFile output(filename);
-	QByteArray buf;
+	/* The code is written directly to the file as it's generated. The QSaveFile only replaces the
+	original file when the whole code is written so a failure doesn't leave a truncated model behind */
+	QSaveFile output(filename);
 
 	output.open(QFile::WriteOnly);
 
@@ -7096,13 +7668,15 @@ void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
 
 	try
 	{
-		buf.append(this->getCodeDefinition(def_type));
-		output.write(buf.data(),buf.size());
-		output.close();
+		writeCodeDefinition(&output, def_type, true);
+
+		if(!output.commit())
+			throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(filename),
+							ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 	catch(Exception &e)
 	{
-		if(output.isOpen()) output.close();
+		output.cancelWriting();
 		throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTER_INV_DEF).arg(filename),
 						ERR_FILE_NOT_WRITTER_INV_DEF,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
@@ -7547,26 +8121,33 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 
 	if(object)
 	{
-		vector<BaseObject *>::iterator itr_perm, itr_perm_end;
 		ObjectType obj_type=object->getObjectType();
 		bool refer=false;
+		set<BaseObject *> added_refs;
+		map<BaseObject *, vector<BaseObject *>>::iterator ref_itr;
+		vector<BaseObject *> no_referrers, *referrers=&no_referrers;
 		Permission *perm=nullptr;
+		BaseRelationship *base_rel=nullptr;
+
+		updateReferencesIndex();
+		ref_itr=obj_referrers.find(object);
+
+		if(ref_itr!=obj_referrers.end())
+			referrers=&ref_itr->second;
 
 		if(!exclude_perms)
 		{
 			//Get the permissions thata references the object
-			itr_perm=permissions.begin();
-			itr_perm_end=permissions.end();
-
-			while(itr_perm!=itr_perm_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			for(auto &ref_obj : *referrers)
 			{
-				perm=dynamic_cast<Permission *>(*itr_perm);
-				if(perm->getObject()==object)
+				perm=dynamic_cast<Permission *>(ref_obj);
+
+				if(perm && perm->getObject()==object && added_refs.insert(perm).second)
 				{
 					refer=true;
 					refs.push_back(perm);
+					if(exclusion_mode) break;
 				}
-				itr_perm++;
 			}
 		}
 
@@ -7576,6 +8157,7 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 			refs.push_back(this);
 		}
 
+		//The children of views and tables are always considered as references to their parents
 		if(obj_type==OBJ_VIEW && (!exclusion_mode || (exclusion_mode && !refer)))
 		{
 			View *view=dynamic_cast<View *>(object);
@@ -7586,1079 +8168,436 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 		if(obj_type==OBJ_TABLE && (!exclusion_mode || (exclusion_mode && !refer)))
 		{
 			Table *table=dynamic_cast<Table *>(object);
-			Sequence *seq=nullptr;
-			Constraint *constr=nullptr;
-			Table *tab=nullptr;
-			Trigger *gat=nullptr;
-			BaseRelationship *base_rel=nullptr;
-			View *view=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			vector<TableObject *> *tab_objs;
-			unsigned i, count;
+			vector<TableObject *> *tab_objs=nullptr;
 			ObjectType tab_obj_types[3]={ OBJ_TRIGGER, OBJ_RULE, OBJ_INDEX };
 
-			for(i=0; i < 3; i++)
+			for(unsigned i=0; i < 3; i++)
 			{
 				tab_objs=table->getObjectList(tab_obj_types[i]);
 				refs.insert(refs.end(), tab_objs->begin(), tab_objs->end());
 			}
+		}
 
-			itr=relationships.begin();
-			itr_end=relationships.end();
+		added_refs.insert(refs.begin(), refs.end());
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+		if(!exclusion_mode || (exclusion_mode && !refer))
+		{
+			for(auto &ref_obj : *referrers)
 			{
-				base_rel=dynamic_cast<BaseRelationship *>(*itr);
-				if(base_rel->getTable(BaseRelationship::SRC_TABLE)==table ||
-						base_rel->getTable(BaseRelationship::DST_TABLE)==table)
-				{
-					refer=true;
-					refs.push_back(base_rel);
-				}
-				itr++;
-			}
+				perm=dynamic_cast<Permission *>(ref_obj);
+				base_rel=dynamic_cast<BaseRelationship *>(ref_obj);
 
-			itr=base_relationships.begin();
-			itr_end=base_relationships.end();
+				//Permissions over the object were already handled above
+				if(perm && perm->getObject()==object)
+					continue;
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				base_rel=dynamic_cast<BaseRelationship *>(*itr);
-				if(base_rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_FK &&
-						(base_rel->getTable(BaseRelationship::SRC_TABLE)==table ||
-						 base_rel->getTable(BaseRelationship::DST_TABLE)==table))
+				/* As base relationship are created automatically by the model they aren't considered
+				as a reference to the table in exclusion mode (except for the fk relationships) */
+				if(exclusion_mode && base_rel && base_rel->getObjectType()==BASE_RELATIONSHIP &&
+						base_rel->getRelationshipType()!=BaseRelationship::RELATIONSHIP_FK)
+					continue;
+
+				if(added_refs.insert(ref_obj).second)
 				{
 					refer=true;
-					refs.push_back(base_rel);
+					refs.push_back(ref_obj);
+					if(exclusion_mode) break;
 				}
-				itr++;
 			}
+		}
 
-			itr=sequences.begin();
-			itr_end=sequences.end();
-
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				seq=dynamic_cast<Sequence *>(*itr);
-				if(seq->getOwnerColumn() &&
-						seq->getOwnerColumn()->getParentTable()==table)
-				{
-					refer=true;
-					refs.push_back(seq);
-				}
+		//Special case: check if the role to be removed is the owner of the database
+		if(obj_type==OBJ_ROLE && (!exclusion_mode || (exclusion_mode && !refer)) && this->getOwner()==object)
+		{
+			refer=true;
+			refs.push_back(this);
+		}
 
-				itr++;
-			}
+		if(obj_type==OBJ_TABLESPACE && (!exclusion_mode || (exclusion_mode && !refer)) &&
+			this->BaseObject::getTablespace()==object)
+		{
+			refer=true;
+			refs.push_back(this);
+		}
+	}
+}
 
-			itr=tables.begin();
-			itr_end=tables.end();
+void DatabaseModel::updateObjectReferences(BaseObject *object)
+{
+	outdated_refs.insert(object);
+}
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				tab=dynamic_cast<Table *>(*itr);
+void DatabaseModel::updateReferencesIndex(void)
+{
+	if(outdated_refs.empty())
+		return;
 
-				count=tab->getConstraintCount();
-				for(i=0; i < count&& (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					constr=tab->getConstraint(i);
-					//If a constraint references its own parent table it'll not be included on the references list
-					if(constr->getConstraintType()==ConstraintType::foreign_key &&
-							constr->getParentTable()!=constr->getReferencedTable() &&
-							constr->getReferencedTable()==table)
-					{
-						refer=true;
-						refs.push_back(constr);
-					}
-				}
+	vector<BaseObject *> objects(outdated_refs.begin(), outdated_refs.end());
 
-				count=tab->getTriggerCount();
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					gat=tab->getTrigger(i);
-					if(gat->getReferencedTable()==table)
-					{
-						refer=true;
-						refs.push_back(gat);
-					}
-				}
+	outdated_refs.clear();
 
-				itr++;
-			}
+	/* Only the objects that are indexed are reindexed, this way any other object that
+	notifies the model (e.g. copies of objects in the operation list) is ignored */
+	for(auto &obj : objects)
+	{
+		if(indexed_refs.count(obj))
+		{
+			unindexObjectReferences(obj);
+			indexObjectReferences(obj);
+		}
+	}
+}
 
-			itr=views.begin();
-			itr_end=views.end();
+void DatabaseModel::indexObjectReferences(BaseObject *object)
+{
+	vector<pair<BaseObject *, BaseObject *>> &ref_pairs=indexed_refs[object];
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				view=dynamic_cast<View *>(*itr);
+	getReferencedObjects(object, ref_pairs);
 
-				if(view->isReferencingTable(table))
-				{
-					refer=true;
-					refs.push_back(view);
-				}
+	for(auto &ref : ref_pairs)
+		obj_referrers[ref.second].push_back(ref.first);
 
-				itr++;
-			}
+	outdated_refs.erase(object);
+}
 
-			/* As base relationship are created automatically by the model they aren't considered
-			as a reference to the table in exclusion mode */
-			itr=base_relationships.begin();
-			itr_end=base_relationships.end();
+void DatabaseModel::unindexObjectReferences(BaseObject *object)
+{
+	map<BaseObject *, vector<pair<BaseObject *, BaseObject *>>>::iterator itr=indexed_refs.find(object);
+	map<BaseObject *, vector<BaseObject *>>::iterator ref_itr;
+	vector<BaseObject *>::reverse_iterator rem_itr;
 
-			while(itr!=itr_end && !exclusion_mode)// || (exclusion_mode && !refer)))
-			{
-				base_rel=dynamic_cast<BaseRelationship *>(*itr);
+	if(itr==indexed_refs.end())
+		return;
 
-				if(base_rel->getTable(BaseRelationship::SRC_TABLE)==table ||
-						base_rel->getTable(BaseRelationship::DST_TABLE)==table)
-				{
-					refer=true;
-					refs.push_back(base_rel);
-				}
-				itr++;
-			}
-		}
+	for(auto &ref : itr->second)
+	{
+		ref_itr=obj_referrers.find(ref.second);
 
-		if(obj_type==OBJ_FUNCTION && (!exclusion_mode || (exclusion_mode && !refer)))
+		if(ref_itr!=obj_referrers.end())
 		{
-			Function *func=dynamic_cast<Function *>(object);
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[]={OBJ_CAST, OBJ_EVENT_TRIGGER, OBJ_CONVERSION,
-									OBJ_AGGREGATE, OBJ_OPERATOR, OBJ_OPCLASS,
-									OBJ_TABLE, OBJ_TYPE, OBJ_LANGUAGE };
-			unsigned i, i1, count, cnt=sizeof(obj_types)/sizeof(ObjectType);
-			Table *tab=nullptr;
-			Aggregate *aggreg=nullptr;
-			Operator *oper=nullptr;
-			Trigger *trig=nullptr;
-			Type *type=nullptr;
-			Language *lang=nullptr;
-			OperatorClass *opclass=nullptr;
-
-			for(i=0; i < cnt && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
-
-				if(obj_types[i]==OBJ_CAST)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						if(dynamic_cast<Cast *>(*itr)->getCastFunction()==func)
-						{
-							refer=true;
-							refs.push_back(*itr);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_EVENT_TRIGGER)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						if(dynamic_cast<EventTrigger *>(*itr)->getFunction()==func)
-						{
-							refer=true;
-							refs.push_back(*itr);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_CONVERSION)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						if(dynamic_cast<Conversion *>(*itr)->getConversionFunction()==func)
-						{
-							refer=true;
-							refs.push_back(*itr);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_AGGREGATE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						aggreg=dynamic_cast<Aggregate *>(*itr);
+			vector<BaseObject *> &referrers=ref_itr->second;
 
-						if(aggreg->getFunction(Aggregate::FINAL_FUNC)==func ||
-								aggreg->getFunction(Aggregate::TRANSITION_FUNC)==func)
-						{
-							refer=true;
-							refs.push_back(aggreg);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_OPERATOR)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						oper=dynamic_cast<Operator *>(*itr);
+			//Searching from the end since the most recently indexed references are there
+			rem_itr=std::find(referrers.rbegin(), referrers.rend(), ref.first);
 
-						if(oper->getFunction(Operator::FUNC_OPERATOR)==func ||
-								oper->getFunction(Operator::FUNC_JOIN)==func  ||
-								oper->getFunction(Operator::FUNC_RESTRICT)==func)
-						{
-							refer=true;
-							refs.push_back(oper);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_OPCLASS)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						opclass=dynamic_cast<OperatorClass *>(*itr);
-						count=opclass->getElementCount();
+			if(rem_itr!=referrers.rend())
+				referrers.erase(std::next(rem_itr).base());
 
-						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(opclass->getElement(i1).getFunction()==func)
-							{
-								refer=true;
-								refs.push_back(opclass);
-							}
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_TABLE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						tab=dynamic_cast<Table *>(*itr);
-						itr++;
-						count=tab->getTriggerCount();
-
-						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							trig=tab->getTrigger(i1);
-
-							if(trig->getFunction()==func)
-							{
-								refer=true;
-								refs.push_back(trig);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_TYPE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						type=dynamic_cast<Type *>(*itr);
-						itr++;
-
-						for(i1=Type::INPUT_FUNC; i1 <= Type::ANALYZE_FUNC && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(type->getFunction(i1)==func)
-							{
-								refer=true;
-								refs.push_back(type);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_LANGUAGE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						lang=dynamic_cast<Language *>(*itr);
-						itr++;
-
-						if(lang->getFunction(Language::HANDLER_FUNC)==func ||
-								lang->getFunction(Language::VALIDATOR_FUNC)==func ||
-								lang->getFunction(Language::INLINE_FUNC)==func)
-						{
-							refer=true;
-							refs.push_back(lang);
-						}
-					}
-				}
-			}
+			if(referrers.empty())
+				obj_referrers.erase(ref_itr);
 		}
+	}
 
-		if(obj_type==OBJ_SCHEMA && (!exclusion_mode || (exclusion_mode && !refer)))
-		{
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[11]={OBJ_FUNCTION, OBJ_TABLE, OBJ_VIEW,
-									  OBJ_DOMAIN, OBJ_AGGREGATE, OBJ_OPERATOR,
-									  OBJ_SEQUENCE, OBJ_CONVERSION,
-									  OBJ_TYPE, OBJ_OPFAMILY, OBJ_OPCLASS};
-			unsigned i;
-
-			for(i=0; i < 11 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
-
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if((*itr)->getSchema()==object)
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
-					itr++;
-				}
-			}
-		}
-
-		if((obj_type==OBJ_TYPE || obj_type==OBJ_DOMAIN || obj_type==OBJ_SEQUENCE ||
-			obj_type==OBJ_TABLE || obj_type==OBJ_EXTENSION || obj_type==OBJ_VIEW)
-				&& (!exclusion_mode || (exclusion_mode && !refer)))
-		{
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[]={OBJ_TABLE, OBJ_OPCLASS, OBJ_CAST,
-									OBJ_DOMAIN, OBJ_FUNCTION, OBJ_AGGREGATE,
-									OBJ_OPERATOR, OBJ_TYPE, OBJ_RELATIONSHIP };
-			unsigned i, i1, count, tp_count = sizeof(obj_types)/sizeof(ObjectType);
-			OperatorClass *op_class=nullptr;
-			OperatorClassElement elem;
-			Table *tab=nullptr;
-			Column *col=nullptr;
-			Cast *cast=nullptr;
-			Domain *dom=nullptr;
-			Function *func=nullptr;
-			Aggregate *aggreg=nullptr;
-			Operator *oper=nullptr;
-			Type *type=nullptr;
-			Relationship *rel=nullptr;
-			void *ptr_pgsqltype=nullptr;
-
-			switch(obj_type)
-			{
-				case OBJ_TYPE: ptr_pgsqltype=dynamic_cast<Type*>(object); break;
-				case OBJ_DOMAIN: ptr_pgsqltype=dynamic_cast<Domain*>(object); break;
-				case OBJ_SEQUENCE: ptr_pgsqltype=dynamic_cast<Sequence*>(object); break;
-				case OBJ_EXTENSION: ptr_pgsqltype=dynamic_cast<Extension*>(object); break;
-				case OBJ_VIEW: ptr_pgsqltype=dynamic_cast<View*>(object); break;
-				default: ptr_pgsqltype=dynamic_cast<Table*>(object); break;
-			}
-
-			for(i=0; i < tp_count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
-
-				if(obj_types[i]==OBJ_RELATIONSHIP)
-				{
-					bool added;
-
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						added=false;
-						rel=dynamic_cast<Relationship *>(*itr);
-						itr++;
-
-						count=rel->getAttributeCount();
-						for(i1=0; i1 < count && !added; i1++)
-						{
-							col=rel->getAttribute(i1);
-
-							if(col->getType()==ptr_pgsqltype)
-							{
-								added=refer=true;
-								refs.push_back(rel);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_TABLE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						tab=dynamic_cast<Table *>(*itr);
-						itr++;
-
-						count=tab->getColumnCount();
-						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							col=tab->getColumn(i1);
+	indexed_refs.erase(itr);
+	outdated_refs.erase(object);
+}
 
-							if(!col->isAddedByRelationship() && col->getType()==ptr_pgsqltype)
-							{
-								refer=true;
-								refs.push_back(col);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_OPCLASS)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						op_class=dynamic_cast<OperatorClass *>(*itr);
-						itr++;
+BaseObject *DatabaseModel::getUserTypeObject(PgSQLType type)
+{
+	void *ptype=type.getUserTypeReference();
 
-						if(op_class->getDataType()==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(op_class);
-						}
+	if(!ptype)
+		return(nullptr);
 
-						for(i1=0; i1 < op_class->getElementCount() && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							elem=op_class->getElement(i1);
-							if(elem.getStorage()==ptr_pgsqltype)
-							{
-								refer=true;
-								refs.push_back(op_class);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_DOMAIN)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						dom=dynamic_cast<Domain *>(*itr);
-						itr++;
+	switch(type.getUserTypeConfig())
+	{
+		case UserTypeConfig::BASE_TYPE: return(static_cast<Type *>(ptype));
+		case UserTypeConfig::DOMAIN_TYPE: return(static_cast<Domain *>(ptype));
+		case UserTypeConfig::TABLE_TYPE: return(static_cast<Table *>(ptype));
+		case UserTypeConfig::VIEW_TYPE: return(static_cast<View *>(ptype));
+		case UserTypeConfig::SEQUENCE_TYPE: return(static_cast<Sequence *>(ptype));
+		case UserTypeConfig::EXTENSION_TYPE: return(static_cast<Extension *>(ptype));
+		default: return(nullptr);
+	}
+}
 
-						if(dom->getType()==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(dom);
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_TYPE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						type=dynamic_cast<Type *>(*itr);
-						itr++;
+void DatabaseModel::getReferencedObjects(BaseObject *object, vector<pair<BaseObject *, BaseObject *>> &ref_pairs)
+{
+	//Types of the objects that can reference schemas, roles (as owners) and collations
+	static const vector<ObjectType> sch_obj_types={ OBJ_FUNCTION, OBJ_TABLE, OBJ_VIEW, OBJ_DOMAIN, OBJ_AGGREGATE,
+			OBJ_OPERATOR, OBJ_SEQUENCE, OBJ_CONVERSION, OBJ_TYPE, OBJ_OPFAMILY, OBJ_OPCLASS },
+			owner_obj_types={ OBJ_FUNCTION, OBJ_TABLE, OBJ_DOMAIN, OBJ_AGGREGATE, OBJ_SCHEMA, OBJ_OPERATOR, OBJ_SEQUENCE,
+			OBJ_CONVERSION, OBJ_LANGUAGE, OBJ_TABLESPACE, OBJ_TYPE, OBJ_OPFAMILY, OBJ_OPCLASS },
+			coll_obj_types={ OBJ_DOMAIN, OBJ_COLLATION, OBJ_TYPE };
 
-						if(type->getAlignment()==ptr_pgsqltype ||
-								type->getElement()==ptr_pgsqltype ||
-								type->getLikeType()==ptr_pgsqltype ||
-								type->getSubtype()==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(type);
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_AGGREGATE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						aggreg=dynamic_cast<Aggregate *>(*itr);
-						itr++;
+	ObjectType obj_type=object->getObjectType();
+	unsigned i, count;
 
-						count=aggreg->getDataTypeCount();
-						for(i1=0; i1 < count  && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(aggreg->getDataType(i1)==ptr_pgsqltype)
-							{
-								refer=true;
-								refs.push_back(aggreg);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_FUNCTION)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						func=dynamic_cast<Function *>(*itr);
-						itr++;
+	auto add_ref=[&ref_pairs](BaseObject *referrer, BaseObject *ref_obj){
+		if(ref_obj)
+			ref_pairs.push_back(make_pair(referrer, ref_obj));
+	};
 
-						if(func->getReturnType()==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(func);
-						}
-						else
-						{
-							count=func->getParameterCount();
-							for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-							{
-								if(func->getParameter(i1).getType()==ptr_pgsqltype)
-								{
-									refer=true;
-									refs.push_back(func);
-								}
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_OPERATOR)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						oper=dynamic_cast<Operator *>(*itr);
-						itr++;
+	auto add_type_ref=[&](BaseObject *referrer, PgSQLType type){
+		add_ref(referrer, getUserTypeObject(type));
+	};
 
-						if(oper->getArgumentType(Operator::LEFT_ARG)==ptr_pgsqltype ||
-								oper->getArgumentType(Operator::RIGHT_ARG)==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(oper);
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_CAST)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						cast=dynamic_cast<Cast *>(*itr);
-						itr++;
+	auto add_table_ref=[&](BaseObject *referrer, BaseTable *table){
+		if(table && table->getObjectType()==OBJ_TABLE)
+			add_ref(referrer, table);
+	};
 
-						if(cast->getDataType(Cast::SRC_TYPE)==ptr_pgsqltype ||
-								cast->getDataType(Cast::DST_TYPE)==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(cast);
-						}
-					}
-				}
-			}
-		}
+	//Registers the columns that makes Constraint::isColumnReferenced() return true
+	auto add_constr_col_refs=[&](BaseObject *referrer, Constraint *constr){
+		ConstraintType constr_type=constr->getConstraintType();
 
-		if(obj_type==OBJ_ROLE && (!exclusion_mode || (exclusion_mode && !refer)))
+		if(constr_type==ConstraintType::primary_key ||
+				constr_type==ConstraintType::unique ||
+				constr_type==ConstraintType::foreign_key)
 		{
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[13]={OBJ_FUNCTION, OBJ_TABLE, OBJ_DOMAIN,
-									  OBJ_AGGREGATE, OBJ_SCHEMA, OBJ_OPERATOR,
-									  OBJ_SEQUENCE, OBJ_CONVERSION,
-									  OBJ_LANGUAGE, OBJ_TABLESPACE,
-									  OBJ_TYPE, OBJ_OPFAMILY, OBJ_OPCLASS};
-			unsigned i,i1, count;
-			Role *role_aux=nullptr;
-			Role *role=dynamic_cast<Role *>(object);
-			unsigned role_types[3]={Role::REF_ROLE, Role::MEMBER_ROLE, Role::ADMIN_ROLE};
-			Permission *perm=nullptr;
-
-			//Check if the role is being referencend by permissions
-			itr=permissions.begin();
-			itr_end=permissions.end();
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				perm=dynamic_cast<Permission *>(*itr);
-				itr++;
-
-				if(perm->isRoleExists(role))
-				{
-					refer=true;
-					refs.push_back(perm);
-				}
-			}
-
-			//Check if the role is being referenced in other roles
-			itr=roles.begin();
-			itr_end=roles.end();
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				role_aux=dynamic_cast<Role *>(*itr);
-				itr++;
-
-				for(i1=0; i1 < 3 && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-				{
-					count=role_aux->getRoleCount(role_types[i1]);
-					for(i=0; i < count && !refer; i++)
-					{
-						if(role_aux->getRole(role_types[i1], i)==role)
-						{
-							refer=true;
-							refs.push_back(role_aux);
-						}
-					}
-				}
-			}
+			for(unsigned col_idx=0; col_idx < constr->getColumnCount(Constraint::SOURCE_COLS); col_idx++)
+				add_ref(referrer, constr->getColumn(col_idx, Constraint::SOURCE_COLS));
 
-			for(i=0; i < 13 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
+			if(constr_type==ConstraintType::foreign_key)
 			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
-
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if((*itr)->getOwner()==role)
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
-					itr++;
-				}
-			}
-
-			//Special case: check if the role to be removed is the owner of the database
-			if((!exclusion_mode || (exclusion_mode && !refer)) && this->getOwner()==role)
-			{
-				refer=true;
-				refs.push_back(this);
+				for(unsigned col_idx=0; col_idx < constr->getColumnCount(Constraint::REFERENCED_COLS); col_idx++)
+					add_ref(referrer, constr->getColumn(col_idx, Constraint::REFERENCED_COLS));
 			}
 		}
-
-		if(obj_type==OBJ_TABLESPACE && (!exclusion_mode || (exclusion_mode && !refer)))
+		else if(constr_type==ConstraintType::exclude)
 		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			unsigned i, count;
-			Table *tab=nullptr;
-			Index *ind=nullptr;
-			Constraint *rest=nullptr;
+			for(auto &elem : constr->getExcludeElements())
+				add_ref(referrer, elem.getColumn());
+		}
+	};
 
-			itr=tables.begin();
-			itr_end=tables.end();
+	ref_pairs.clear();
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				tab=dynamic_cast<Table *>(*itr);
+	if(std::find(sch_obj_types.begin(), sch_obj_types.end(), obj_type)!=sch_obj_types.end())
+		add_ref(object, object->getSchema());
 
-				if(tab->getTablespace()==object)
-				{
-					refer=true;
-					refs.push_back(tab);
-				}
+	if(std::find(owner_obj_types.begin(), owner_obj_types.end(), obj_type)!=owner_obj_types.end())
+		add_ref(object, object->getOwner());
 
-				count=tab->getIndexCount();
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					ind=tab->getIndex(i);
-					if(ind->getTablespace()==object)
-					{
-						refer=true;
-						refs.push_back(ind);
-					}
-				}
+	if(std::find(coll_obj_types.begin(), coll_obj_types.end(), obj_type)!=coll_obj_types.end())
+		add_ref(object, object->getCollation());
 
-				count=tab->getConstraintCount();
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					rest=tab->getConstraint(i);
-					if(rest->getTablespace()==object)
-					{
-						refer=true;
-						refs.push_back(rest);
-					}
-				}
+	if(obj_type==OBJ_PERMISSION)
+	{
+		Permission *perm=dynamic_cast<Permission *>(object);
 
-				itr++;
-			}
+		add_ref(perm, perm->getObject());
 
-			if((!exclusion_mode || (exclusion_mode && !refer)) && this->BaseObject::getTablespace()==object)
-			{
-				refer=true;
-				refs.push_back(this);
-			}
-		}
+		for(i=0; i < perm->getRoleCount(); i++)
+			add_ref(perm, perm->getRole(i));
+	}
+	else if(obj_type==OBJ_ROLE)
+	{
+		Role *role=dynamic_cast<Role *>(object);
+		unsigned role_types[3]={Role::REF_ROLE, Role::MEMBER_ROLE, Role::ADMIN_ROLE};
 
-		if(obj_type==OBJ_LANGUAGE && (!exclusion_mode || (exclusion_mode && !refer)))
+		for(unsigned i1=0; i1 < 3; i1++)
 		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			Function *func=nullptr;
-
-			itr=functions.begin();
-			itr_end=functions.end();
-
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				func=dynamic_cast<Function *>(*itr);
-				if(func->getLanguage()==object)
-				{
-					refer=true;
-					refs.push_back(func);
-				}
-				itr++;
-			}
+			count=role->getRoleCount(role_types[i1]);
+			for(i=0; i < count; i++)
+				add_ref(role, role->getRole(role_types[i1], i));
 		}
+	}
+	else if(obj_type==OBJ_TABLE)
+	{
+		Table *table=dynamic_cast<Table *>(object);
+		Column *col=nullptr;
+		Constraint *constr=nullptr;
+		Index *index=nullptr;
+		Trigger *trig=nullptr;
+		ConstraintType constr_type;
 
-		if(obj_type==OBJ_OPCLASS && (!exclusion_mode || (exclusion_mode && !refer)))
-		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			Type *usertype=nullptr;
-			Index *ind=nullptr;
-			Constraint *constr=nullptr;
-			Table *table=nullptr;
-
-			itr=types.begin();
-			itr_end=types.end();
-
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				usertype=dynamic_cast<Type *>(*itr);
-
-				if(usertype->getSubtypeOpClass()==object)
-				{
-					refer=true;
-					refs.push_back(usertype);
-				}
-				itr++;
-			}
-
-			itr=tables.begin();
-			itr_end=tables.end();
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				table=dynamic_cast<Table *>(*itr);
-
-				//Checking if the indexes are referencing the operator class
-				for(unsigned idx=0; idx < table->getIndexCount() &&
-					(!exclusion_mode || (exclusion_mode && !refer)); idx++)
-				{
-					ind=table->getIndex(idx);
-
-					for(unsigned id_elem=0; id_elem < ind->getIndexElementCount() &&
-						(!exclusion_mode || (exclusion_mode && !refer)); id_elem++)
-					{
-						if(ind->getIndexElement(id_elem).getOperatorClass()==object)
-						{
-							refer=true;
-							refs.push_back(ind);
-						}
-					}
-				}
+		add_ref(table, table->getTablespace());
+		add_ref(table, table->getTag());
 
-				//Checking if the constraints are referencing the operator class
-				for(unsigned idx=0; idx < table->getConstraintCount() &&
-					(!exclusion_mode || (exclusion_mode && !refer)); idx++)
-				{
-					constr=table->getConstraint(idx);
+		count=table->getColumnCount();
+		for(i=0; i < count; i++)
+		{
+			col=table->getColumn(i);
 
-					for(unsigned id_elem=0; id_elem < constr->getExcludeElementCount() &&
-						(!exclusion_mode || (exclusion_mode && !refer)); id_elem++)
-					{
-						if(constr->getExcludeElement(id_elem).getOperatorClass()==object)
-						{
-							refer=true;
-							refs.push_back(constr);
-						}
-					}
-				}
+			//Columns added by relationships aren't considered as references to their data types
+			if(!col->isAddedByRelationship())
+				add_type_ref(col, col->getType());
 
-				itr++;
-			}
+			add_ref(col, col->getCollation());
+			add_ref(col, col->getSequence());
 		}
 
-		if(obj_type==OBJ_OPERATOR && (!exclusion_mode || (exclusion_mode && !refer)))
+		count=table->getConstraintCount();
+		for(i=0; i < count; i++)
 		{
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[]={OBJ_OPCLASS,
-									OBJ_AGGREGATE,
-									OBJ_OPERATOR,
-									OBJ_TABLE };
-			unsigned i, i1, count;
-			OperatorClass *op_class=nullptr;
-			Operator *oper_aux=nullptr, *oper=dynamic_cast<Operator *>(object);
-			Table *table=nullptr;
-			Constraint *constr=nullptr;
-
-			for(i=0; i < 4 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
-
-				if(obj_types[i]==OBJ_OPCLASS)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						op_class=dynamic_cast<OperatorClass *>(*itr);
-						itr++;
+			constr=table->getConstraint(i);
+			constr_type=constr->getConstraintType();
 
-						count=op_class->getElementCount();
-						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(op_class->getElement(i1).getOperator()==oper)
-							{
-								refer=true;
-								refs.push_back(op_class);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_AGGREGATE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						if(dynamic_cast<Aggregate *>(*itr)->getSortOperator()==oper)
-						{
-							refer=true;
-							refs.push_back(*itr);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_OPERATOR)
-				{
-					while(itr!=itr_end && !refer)
-					{
-						oper_aux=dynamic_cast<Operator *>(*itr);
-						itr++;
+			//If a constraint references its own parent table it'll not be included on the references list
+			if(constr_type==ConstraintType::foreign_key && constr->getReferencedTable()!=constr->getParentTable())
+				add_table_ref(constr, constr->getReferencedTable());
 
-						for(i1=Operator::OPER_COMMUTATOR; i1 <= Operator::OPER_NEGATOR &&
-							(!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(oper_aux->getOperator(i1)==oper)
-							{
-								refer=true;
-								refs.push_back(oper_aux);
-							}
-						}
-					}
-				}
-				else
-				{
-					while(itr!=itr_end && !refer)
-					{
-						table=dynamic_cast<Table *>(*itr);
-						itr++;
+			add_ref(constr, constr->getTablespace());
+			add_constr_col_refs(constr, constr);
 
-						count=table->getConstraintCount();
-						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							constr=table->getConstraint(i1);
+			for(auto &elem : constr->getExcludeElements())
+			{
+				add_ref(constr, elem.getOperatorClass());
 
-							if(constr->getConstraintType()==ConstraintType::exclude)
-							{
-								for(auto &elem : constr->getExcludeElements())
-								{
-									if(elem.getOperator()==oper)
-									{
-										refer=true;
-										refs.push_back(constr);
-										if(exclusion_mode) break;
-									}
-								}
-							}
-						}
-					}
-				}
+				if(constr_type==ConstraintType::exclude)
+					add_ref(constr, elem.getOperator());
 			}
 		}
 
-		if(obj_type==OBJ_OPFAMILY && (!exclusion_mode || (exclusion_mode && !refer)))
+		count=table->getIndexCount();
+		for(i=0; i < count; i++)
 		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			OperatorFamily *op_family=dynamic_cast<OperatorFamily *>(object);
-
-			itr=op_classes.begin();
-			itr_end=op_classes.end();
+			index=table->getIndex(i);
+			add_ref(index, index->getTablespace());
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			for(auto &elem : index->getIndexElements())
 			{
-				if(dynamic_cast<OperatorClass *>(*itr)->getFamily()==op_family)
-				{
-					refer=true;
-					refs.push_back(*itr);
-				}
-				itr++;
+				add_ref(index, elem.getColumn());
+				add_ref(index, elem.getOperatorClass());
+				add_ref(index, elem.getCollation());
 			}
 		}
 
-		if(obj_type==OBJ_COLLATION && (!exclusion_mode || (exclusion_mode && !refer)))
+		count=table->getTriggerCount();
+		for(i=0; i < count; i++)
 		{
-			ObjectType  obj_types[]={ OBJ_DOMAIN, OBJ_COLLATION, OBJ_TYPE },
-					tab_obj_types[]={ OBJ_COLUMN, OBJ_INDEX };
-			unsigned i, count;
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			vector<TableObject *> *tab_obj_list=nullptr;
-			vector<TableObject *>::iterator tab_itr, tab_itr_end;
-			TableObject *tab_obj=nullptr;
+			trig=table->getTrigger(i);
+			add_table_ref(trig, trig->getReferencedTable());
+			add_ref(trig, trig->getFunction());
 
-			count=sizeof(obj_types)/sizeof(ObjectType);
-			for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+			for(unsigned i1=0; i1 < trig->getColumnCount(); i1++)
+				add_ref(trig, trig->getColumn(i1));
+		}
+	}
+	else if(obj_type==OBJ_VIEW)
+	{
+		View *view=dynamic_cast<View *>(object);
+		Reference ref;
 
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if((*itr)->getCollation()==object)
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
+		add_ref(view, view->getTag());
 
-					itr++;
-				}
-			}
+		count=view->getReferenceCount();
+		for(i=0; i < count; i++)
+		{
+			ref=view->getReference(i);
+			add_ref(view, ref.getTable());
+			add_ref(view, ref.getColumn());
+		}
+	}
+	else if(obj_type==OBJ_RELATIONSHIP || obj_type==BASE_RELATIONSHIP)
+	{
+		BaseRelationship *base_rel=dynamic_cast<BaseRelationship *>(object);
+		Relationship *rel=dynamic_cast<Relationship *>(object);
 
-			count=sizeof(tab_obj_types)/sizeof(ObjectType);
-			obj_list=getObjectList(OBJ_TABLE);
-			itr=obj_list->begin();
-			itr_end=obj_list->end();
+		add_table_ref(base_rel, base_rel->getTable(BaseRelationship::SRC_TABLE));
+		add_table_ref(base_rel, base_rel->getTable(BaseRelationship::DST_TABLE));
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					tab_obj_list=dynamic_cast<Table *>(*itr)->getObjectList(tab_obj_types[i]);
-					tab_itr=tab_obj_list->begin();
-					tab_itr_end=tab_obj_list->end();
+		if(rel)
+		{
+			count=rel->getAttributeCount();
+			for(i=0; i < count; i++)
+				add_type_ref(rel, rel->getAttribute(i)->getType());
 
-					while(tab_itr!=tab_itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						tab_obj=(*tab_itr);
-						if((tab_obj->getObjectType()==OBJ_COLUMN && tab_obj->getCollation()==object) ||
-								(tab_obj->getObjectType()==OBJ_INDEX &&
-								 dynamic_cast<Index *>(tab_obj)->isReferCollation(dynamic_cast<Collation *>(object))))
-						{
-							refer=true;
-							refs.push_back(*tab_itr);
-						}
-						tab_itr++;
-					}
-				}
-				itr++;
-			}
+			count=rel->getConstraintCount();
+			for(i=0; i < count; i++)
+				add_constr_col_refs(rel, rel->getConstraint(i));
 		}
+	}
+	else if(obj_type==OBJ_SEQUENCE)
+	{
+		Sequence *seq=dynamic_cast<Sequence *>(object);
+		Column *col=seq->getOwnerColumn();
 
-		if(obj_type==OBJ_COLUMN && (!exclusion_mode || (exclusion_mode && !refer)))
+		if(col)
 		{
-			Column *column=dynamic_cast<Column *>(object);
-			vector<BaseObject *> *obj_list=nullptr;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType  obj_types[]={ OBJ_SEQUENCE, OBJ_VIEW, OBJ_TABLE, OBJ_RELATIONSHIP };
-			unsigned i, count=sizeof(obj_types)/sizeof(ObjectType);
-
-			for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
-
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if((obj_types[i]==OBJ_SEQUENCE && dynamic_cast<Sequence *>(*itr)->getOwnerColumn()==column) ||
-							(obj_types[i]==OBJ_VIEW && dynamic_cast<View *>(*itr)->isReferencingColumn(column)))
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
-					else if(obj_types[i]==OBJ_TABLE)
-					{
-						Table *tab=dynamic_cast<Table *>(*itr);
-						unsigned count, idx, count1, i1;
-						Trigger *trig=nullptr;
-						Index *index=nullptr;
-						Constraint *constr=nullptr;
-
-						count=tab->getConstraintCount();
-						for(idx=0; idx < count && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							constr=tab->getConstraint(idx);
-							if(constr->isColumnReferenced(column))
-							{
-								refer=true;
-								refs.push_back(constr);
-							}
-						}
+			add_ref(seq, col);
+			add_table_ref(seq, col->getParentTable());
+		}
+	}
+	else if(obj_type==OBJ_FUNCTION)
+	{
+		Function *func=dynamic_cast<Function *>(object);
 
-						count=tab->getIndexCount();
-						for(idx=0; idx < count && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							index=tab->getIndex(idx);
-							if(index->isReferColumn(column))
-							{
-								refer=true;
-								refs.push_back(index);
-							}
-						}
+		add_ref(func, func->getLanguage());
+		add_type_ref(func, func->getReturnType());
 
-						count=tab->getTriggerCount();
-						for(idx=0; idx < count && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							trig=tab->getTrigger(idx);
-							count1=trig->getColumnCount();
+		count=func->getParameterCount();
+		for(i=0; i < count; i++)
+			add_type_ref(func, func->getParameter(i).getType());
+	}
+	else if(obj_type==OBJ_CAST)
+	{
+		Cast *cast=dynamic_cast<Cast *>(object);
 
-							for(i1=0; i1 < count1 && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-							{
-								if(trig->getColumn(i1)==column)
-								{
-									refer=true;
-									refs.push_back(trig);
-								}
-							}
-						}
-					}
-					else if(obj_types[i]==OBJ_RELATIONSHIP)
-					{
-						Relationship *rel=dynamic_cast<Relationship *>(*itr);
-						unsigned constr_cnt, idx;
+		add_ref(cast, cast->getCastFunction());
+		add_type_ref(cast, cast->getDataType(Cast::SRC_TYPE));
+		add_type_ref(cast, cast->getDataType(Cast::DST_TYPE));
+	}
+	else if(obj_type==OBJ_EVENT_TRIGGER)
+		add_ref(object, dynamic_cast<EventTrigger *>(object)->getFunction());
+	else if(obj_type==OBJ_CONVERSION)
+		add_ref(object, dynamic_cast<Conversion *>(object)->getConversionFunction());
+	else if(obj_type==OBJ_AGGREGATE)
+	{
+		Aggregate *aggreg=dynamic_cast<Aggregate *>(object);
 
-						constr_cnt=rel->getConstraintCount();
-						for(idx=0; idx < constr_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							if(rel->getConstraint(idx)->isColumnReferenced(column))
-							{
-								refer=true;
-								refs.push_back(rel);
-							}
-						}
-					}
+		add_ref(aggreg, aggreg->getFunction(Aggregate::FINAL_FUNC));
+		add_ref(aggreg, aggreg->getFunction(Aggregate::TRANSITION_FUNC));
+		add_ref(aggreg, aggreg->getSortOperator());
 
-					itr++;
-				}
-			}
-		}
+		count=aggreg->getDataTypeCount();
+		for(i=0; i < count; i++)
+			add_type_ref(aggreg, aggreg->getDataType(i));
+	}
+	else if(obj_type==OBJ_OPERATOR)
+	{
+		Operator *oper=dynamic_cast<Operator *>(object);
 
+		for(i=Operator::FUNC_OPERATOR; i <= Operator::FUNC_RESTRICT; i++)
+			add_ref(oper, oper->getFunction(i));
 
-		if(obj_type==OBJ_TAG && (!exclusion_mode || (exclusion_mode && !refer)))
-		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			vector<BaseObject *> list;
-			Tag *tag=dynamic_cast<Tag *>(object);
+		for(i=Operator::OPER_COMMUTATOR; i <= Operator::OPER_NEGATOR; i++)
+			add_ref(oper, oper->getOperator(i));
 
-			list.assign(tables.begin(), tables.end());
-			list.insert(list.end(), views.begin(), views.end());
+		add_type_ref(oper, oper->getArgumentType(Operator::LEFT_ARG));
+		add_type_ref(oper, oper->getArgumentType(Operator::RIGHT_ARG));
+	}
+	else if(obj_type==OBJ_OPCLASS)
+	{
+		OperatorClass *op_class=dynamic_cast<OperatorClass *>(object);
+		OperatorClassElement elem;
 
-			itr=list.begin();
-			itr_end=list.end();
+		add_ref(op_class, op_class->getFamily());
+		add_type_ref(op_class, op_class->getDataType());
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				if(dynamic_cast<BaseTable *>(*itr)->getTag()==tag)
-				{
-					refer=true;
-					refs.push_back(*itr);
-				}
-				itr++;
-			}
+		count=op_class->getElementCount();
+		for(i=0; i < count; i++)
+		{
+			elem=op_class->getElement(i);
+			add_ref(op_class, elem.getFunction());
+			add_ref(op_class, elem.getOperator());
+			add_type_ref(op_class, elem.getStorage());
 		}
+	}
+	else if(obj_type==OBJ_TYPE)
+	{
+		Type *type=dynamic_cast<Type *>(object);
 
-		if(obj_type==OBJ_SEQUENCE && (!exclusion_mode || (exclusion_mode && !refer)))
-		{
-			Table *table=nullptr;
-			vector<TableObject *> *cols=nullptr;
-			vector<TableObject *>::iterator itr, itr_end;
-			unsigned i, cnt=tables.size();
+		for(i=Type::INPUT_FUNC; i <= Type::ANALYZE_FUNC; i++)
+			add_ref(type, type->getFunction(i));
 
-			for(i=0; i < cnt && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				table=dynamic_cast<Table *>(tables[i]);
-				cols=table->getObjectList(OBJ_COLUMN);
-				itr=cols->begin();
-				itr_end=cols->end();
+		add_ref(type, type->getSubtypeOpClass());
+		add_type_ref(type, type->getAlignment());
+		add_type_ref(type, type->getElement());
+		add_type_ref(type, type->getLikeType());
+		add_type_ref(type, type->getSubtype());
+	}
+	else if(obj_type==OBJ_LANGUAGE)
+	{
+		Language *lang=dynamic_cast<Language *>(object);
 
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if(dynamic_cast<Column *>(*itr)->getSequence()==object)
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
-					itr++;
-				}
-			}
-		}
+		add_ref(lang, lang->getFunction(Language::HANDLER_FUNC));
+		add_ref(lang, lang->getFunction(Language::VALIDATOR_FUNC));
+		add_ref(lang, lang->getFunction(Language::INLINE_FUNC));
 	}
+	else if(obj_type==OBJ_DOMAIN)
+		add_type_ref(object, dynamic_cast<Domain *>(object)->getType());
 }
 
 void DatabaseModel::__getObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclude_perms)
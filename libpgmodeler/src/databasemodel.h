@@ -28,8 +28,12 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #define DATABASE_MODEL_H
 
 #include <QFile>
+#include <QHash>
+#include <QSaveFile>
+#include <QTextStream>
 #include <QObject>
 #include <QStringList>
+#include <QtConcurrentMap>
 #include "baseobject.h"
 #include "table.h"
 #include "function.h"
@@ -55,6 +59,8 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include "eventtrigger.h"
 #include "genericsql.h"
 #include <algorithm>
+#include <functional>
+#include <set>
 #include <locale.h>
 
 class ModelWidget;
@@ -118,6 +124,25 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 when revalidating the relationships */
 		map<unsigned, QString> xml_special_objs;
 
+		/*! \brief Stores, per object type, the objects indexed by their signatures (without quotes).
+		This structure speeds up the name lookups done by getObject(). An index is lazily (re)built
+		on the first lookup after being discarded (see updateObjectIndex()). Permissions aren't indexed
+		since they are handled apart from the other objects (see addPermission()) */
+		map<ObjectType, QHash<QString, BaseObject *>> obj_indexes;
+
+		/*! \brief Reverse references index: stores for each object the objects (or their children) that
+		are referencing it. A referrer appears once per reference it holds to the object. This structure
+		is used by getObjectReferences() in order to avoid a sweep over the whole model on each query */
+		map<BaseObject *, vector<BaseObject *>> obj_referrers;
+
+		/*! \brief Stores the references (referrer, referenced object) registered by each object on the
+		reverse references index. The referrer is the object itself or one of its children (e.g. table columns) */
+		map<BaseObject *, vector<pair<BaseObject *, BaseObject *>>> indexed_refs;
+
+		/*! \brief Stores the objects that had their code invalidated since their references were indexed.
+		Their references are reindexed on the next query (see updateReferencesIndex()) */
+		set<BaseObject *> outdated_refs;
+
 		//! \brief Indicates if the model is being loaded
 		bool loading_model,
 
@@ -140,6 +165,47 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 the object index */
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
 
+		//! \brief Returns the lookup index of the specified object type, (re)building it when needed
+		QHash<QString, BaseObject *> &getLookupIndex(ObjectType obj_type);
+
+		/*! \brief Discards the lookup indexes affected by the signature change of the passed object.
+		Since schemas names are part of the signature of their children all indexes are discarded
+		when a schema is renamed. The indexes of types that have data types in their signatures
+		(functions, operators, aggregates and casts) are discarded as well since the renamed object
+		can be an user defined type */
+		virtual void updateObjectIndex(BaseObject *object);
+
+		/*! \brief Marks the references of the passed object as outdated. Since every change on the objects
+		that affects their references invalidates their code, this method is called by the objects of the model
+		each time their code is invalidated (for table children the parent table is the one that notifies the model) */
+		virtual void updateObjectReferences(BaseObject *object);
+
+		/*! \brief Returns the pairs (referrer, referenced object) of the references held by the passed object.
+		The referrer is the object itself or one of its children (table columns, constraints, indexes and triggers).
+		Only the references that are checked by getObjectReferences() are returned */
+		void getReferencedObjects(BaseObject *object, vector<pair<BaseObject *, BaseObject *>> &ref_pairs);
+
+		//! \brief Registers the references held by the object (and its children) on the reverse references index
+		void indexObjectReferences(BaseObject *object);
+
+		//! \brief Removes the references held by the object (and its children) from the reverse references index
+		void unindexObjectReferences(BaseObject *object);
+
+		//! \brief Reindexes the references of the objects that were modified since the last query
+		void updateReferencesIndex(void);
+
+		/*! \brief Returns the object on the model that is referenced by the user defined type. Differently from
+		getObjectPgSQLType() this method doesn't do any lookup since the type holds the reference to the object */
+		BaseObject *getUserTypeObject(PgSQLType type);
+
+		/*! \brief Returns, in the same order they appear in the model, all the table-table relationships that are linked
+		directly or indirectly (through other tables and relationships) to the passed ones, including themselves. The returned
+		list is the portion of the model that must be reconnected when one of the passed relationships is invalidated */
+		vector<BaseObject *> getLinkedRelationships(const vector<BaseObject *> &rels);
+
+		//! \brief Disconnects only the passed relationships, from the last to the first, keeping the others untouched
+		void disconnectRelationships(const vector<BaseObject *> &rels);
+
 		//! \brief Generic method that adds an object to the model
 		void __addObject(BaseObject *object, int obj_idx=-1);
 
@@ -163,6 +229,28 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns extra error info when loading database models
 		QString getErrorExtraInfo(void);
 
+		/*! \brief Returns if the code of the passed object can be generated in a worker thread while
+		other objects have their code generated too. This is true only for objects which code generation
+		touches nothing but themselves and their own children, reading only the names of other objects.
+		Currently, only the SQL code of tables, views, sequences, domains and foreign keys is generated this way */
+		bool isParallelCodeGenAllowed(BaseObject *object, unsigned def_type);
+
+		/*! \brief Generates in a thread pool the code of the objects in the list which are allowed to be handled in parallel
+		(see isParallelCodeGenAllowed()). The generated code is stored in 'codes' indexed by the objects */
+		void generateCodeInParallel(const vector<BaseObject *> &objects, unsigned def_type, map<BaseObject *, QString> &codes);
+
+		/*! \brief Returns the code of the object as part of the whole model's code. The 'attrib' receives the
+		attribute of the dbmodel schema file in which the code must be placed and the 'search_path' is incremented
+		with the name of the object when it's a schema */
+		QString getModelObjectCode(BaseObject *object, unsigned def_type, QString &attrib, QString &search_path);
+
+		//! \brief Writes the complete SQL/XML definition of the model onto the stream (see writeCodeDefinition(QIODevice *...))
+		void writeCodeDefinition(QTextStream &out, unsigned def_type, bool export_file);
+
+		/*! \brief Generates the complete SQL/XML definition of the model in creation order passing each piece of code to 'write_code'
+		along with the object which generated it (null for the pieces that belong to the model itself, like headers and auxiliary commands) */
+		void writeCodeDefinition(const function<void(BaseObject *, const QString &)> &write_code, unsigned def_type, bool export_file);
+
 	public:
 		static const unsigned META_DB_ATTRIBUTES=1,	//! \brief Handle database model attribute when save/load metadata file
 		META_OBJS_POSITIONING=2,	//! \brief Handle objects' positioning when save/load metadata file
@@ -177,6 +265,22 @@ class DatabaseModel:  public QObject, public BaseObject {
 		META_GENERIC_SQL_OBJS=1024,	//! \brief Handle generic sql object when save/load metadata file
 		META_ALL_INFO=2047;	//! \brief Handle all metadata information about objects when save/load metadata file
 
+		//! \brief Stores a single SQL statement of the model's code along with the object created/changed/dropped by it
+		struct SQLStatement {
+			//! \brief Object which code contains the statement (null for the model's auxiliary commands and raw buffers)
+			BaseObject *object;
+
+			//! \brief Type and signature of the object handled by the statement (BASE_OBJECT when it can't be determined)
+			ObjectType obj_type;
+			QString obj_name,
+
+			//! \brief Code of the statement without comments
+			sql;
+
+			//! \brief Indicates that the statement is the DROP command attached to the object's code
+			bool is_drop;
+		};
+
 		DatabaseModel(void);
 
 		//! \brief Creates a database model and assign the model widget which will manage this instance
@@ -197,7 +301,9 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 by relationship) in order to be reconstructed in a posterior moment */
 		void storeSpecialObjectsXML(void);
 
-		//! \brief Validates all the relationship, propagating all column modifications over the tables
+		/*! \brief Validates all the relationship, propagating all column modifications over the tables.
+		Only the relationships linked to the invalidated ones are disconnected and reconnected. In case some
+		relationship remains invalidated after that the method falls back to the validation of all relationships */
 		void validateRelationships(void);
 
 		//! \brief Returns the list of specified object type that belongs to the passed schema
@@ -296,6 +402,11 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Saves the specified code definition for the model on the specified filename
 		void saveModel(const QString &filename, unsigned def_type);
 
+		/*! \brief Writes the complete SQL/XML definition of the model (UTF-8 encoded) onto the output device.
+		Differently from getCodeDefinition() the code of each object is written as soon as it's generated,
+		in creation order, so the whole definition is never held in memory at once */
+		void writeCodeDefinition(QIODevice *output, unsigned def_type, bool export_file);
+
 		/*! \brief Returns the complete SQL/XML defintion for the entire model (including all the other objects).
 		 The parameter 'export_file' is used to format the generated code in a way that can be saved
 		 in na SQL file and executed later on the DBMS server. This parameter is only used for SQL definition. */
@@ -307,6 +418,16 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the code definition only for the database (excluding the definition of the other objects)
 		QString __getCodeDefinition(unsigned def_type);
 
+		/*! \brief Returns the SQL code of the model, in the form used to export it to the DBMS, as a list of statements in
+		creation order. Each statement carries the object which generated it so there's no need to parse the code to identify them.
+		When incl_drop_cmds is true the DROP commands attached to the enabled objects are included as separated statements */
+		vector<SQLStatement> getSQLStatements(bool incl_drop_cmds);
+
+		/*! \brief Splits the provided code into statements (delimited by the ddl end token) appending them to 'stmts'. The 'object'
+		is the one that generated the code and can be null when the code is a raw buffer (e.g. a diff code), in that case the object
+		of each statement is identified from the object's header comment or from the command's keywords */
+		static void splitSQLStatements(const QString &code, BaseObject *object, bool incl_drop_cmds, vector<SQLStatement> &stmts);
+
 		/*! \brief Returns the creation order of objects in each definition type (SQL or XML).
 
 		The parameter incl_relnn_objs when 'true' includes the generated objects (table and constraint)
@@ -443,6 +443,7 @@ void Function::createSignature(bool format, bool prepend_schema)
 	//Signature format NAME(IN|OUT PARAM1_TYPE,IN|OUT PARAM2_TYPE,...,IN|OUT PARAMn_TYPE)
 	signature=this->getName(format, prepend_schema) + QString("(") + str_param + QString(")");
 	this->setCodeInvalidated(true);
+	notifySignatureChange();
 }
 
 QString Function::getCodeDefinition(unsigned def_type)
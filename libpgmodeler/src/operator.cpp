@@ -86,7 +86,11 @@ void Operator::setName(const QString &name)
 	else	if(!isValidName(name))
 		throw Exception(ERR_ASG_INV_NAME_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	this->obj_name=name;
+	if(this->obj_name!=name)
+	{
+		this->obj_name=name;
+		notifySignatureChange();
+	}
 }
 
 void Operator::setFunction(Function *func, unsigned func_type)
@@ -159,6 +163,7 @@ void Operator::setArgumentType(PgSQLType arg_type, unsigned arg_id)
 
 	setCodeInvalidated(argument_types[arg_id] != arg_type);
 	argument_types[arg_id]=arg_type;
+	notifySignatureChange();
 }
 
 void Operator::setOperator(Operator *oper, unsigned op_type)
@@ -55,6 +55,7 @@ void OperatorClass::setIndexingType(IndexingType index_type)
 {
 	setCodeInvalidated(indexing_type != index_type);
 	this->indexing_type=index_type;
+	notifySignatureChange();
 }
 
 void OperatorClass::setDefault(bool value)
@@ -88,6 +89,7 @@ void OperatorClass::addElement(OperatorClassElement elem)
 	//	throw Exception(ERR_INS_DUPLIC_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	elements.push_back(elem);
+	setCodeInvalidated(true);
 }
 
 void OperatorClass::removeElement(unsigned elem_idx)
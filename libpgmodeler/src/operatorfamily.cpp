@@ -28,6 +28,7 @@ void OperatorFamily::setIndexingType(IndexingType idx_type)
 {
 	setCodeInvalidated(indexing_type != idx_type);
 	indexing_type=idx_type;
+	notifySignatureChange();
 }
 
 IndexingType OperatorFamily::getIndexingType(void)
@@ -467,6 +467,7 @@ void Relationship::addObject(TableObject *tab_obj, int obj_idx)
 
 			tab_obj->setAddedByLinking(true);
 			this->invalidated=true;
+			setCodeInvalidated(true);
 		}
 		else
 			throw Exception(QString(Exception::getErrorMessage(ERR_ASG_DUPLIC_OBJECT))
@@ -577,6 +578,7 @@ void Relationship::removeObject(unsigned obj_id, ObjectType obj_type)
 	//Removes the column
 	obj_list->erase(obj_list->begin() + obj_id);
 	this->invalidated=true;
+	setCodeInvalidated(true);
 }
 
 void Relationship::removeObject(TableObject *object)
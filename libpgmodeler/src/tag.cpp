@@ -46,7 +46,11 @@ void Tag::setName(const QString &name)
 	else if(name.size() > BaseObject::OBJECT_NAME_MAX_LENGTH)
 		throw Exception(ERR_ASG_LONG_NAME_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	this->obj_name=name;
+	if(this->obj_name!=name)
+	{
+		this->obj_name=name;
+		notifySignatureChange();
+	}
 }
 
 QString Tag::getName(bool, bool)
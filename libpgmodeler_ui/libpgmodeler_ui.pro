@@ -110,7 +110,9 @@ SOURCES += src/mainwindow.cpp \
 		src/plaintextitemdelegate.cpp \
 		src/csvloadwidget.cpp \
 		src/genericsqlwidget.cpp \
-    src/sceneinfowidget.cpp
+    src/sceneinfowidget.cpp \
+		src/cursortablemodel.cpp \
+		src/resultsetmodel.cpp
 
 
 HEADERS += src/mainwindow.h \
@@ -208,7 +210,9 @@ HEADERS += src/mainwindow.h \
 		src/plaintextitemdelegate.h \
 		src/csvloadwidget.h \
 		src/genericsqlwidget.h \
-    src/sceneinfowidget.h
+    src/sceneinfowidget.h \
+		src/cursortablemodel.h \
+		src/resultsetmodel.h
 
 FORMS += ui/mainwindow.ui \
 	 ui/textboxwidget.ui \
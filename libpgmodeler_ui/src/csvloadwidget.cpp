@@ -20,11 +20,13 @@
 #include <QFileDialog>
 #include "exception.h"
 #include <QTextStream>
+#include <QBuffer>
 
 CsvLoadWidget::CsvLoadWidget(QWidget * parent, bool cols_in_first_row) : QWidget(parent)
 {
 	setupUi(this);
 	separator_edt->setVisible(false);
+	this->cols_in_first_row=false;
 
 	if(!cols_in_first_row)
 	{
@@ -58,9 +60,46 @@ QStringList CsvLoadWidget::getCsvColumns(void)
 
 QList<QStringList> CsvLoadWidget::getCsvRows(void)
 {
+	QList<QStringList> csv_rows;
+	QStringList values;
+	QFile file;
+
+	if(csv_filename.isEmpty())
+		return(csv_rows);
+
+	file.setFileName(csv_filename);
+
+	if(!file.open(QFile::ReadOnly))
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED).arg(csv_filename),
+										ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	CsvReader reader(&file, separator, text_delim);
+
+	//Skipping the row containing the column names
+	if(cols_in_first_row)
+		reader.readRow(values);
+
+	while(reader.readRow(values))
+		csv_rows.append(values);
+
 	return(csv_rows);
 }
 
+QString CsvLoadWidget::getCsvFilename(void)
+{
+	return(csv_filename);
+}
+
+QString CsvLoadWidget::getSeparator(void)
+{
+	return(separator);
+}
+
+QString CsvLoadWidget::getTextDelimiter(void)
+{
+	return(text_delim);
+}
+
 void CsvLoadWidget::selectCsvFile(void)
 {
 	QFileDialog file_dlg;
@@ -86,44 +125,18 @@ QList<QStringList> CsvLoadWidget::loadCsvFromBuffer(const QString &csv_buffer, c
 
 	if(!csv_buffer.isEmpty())
 	{
-		QString	double_quote=QString("%1%1").arg(text_delim),
-				placeholder = QString("⁋"), aux_buffer = csv_buffer;
-		QStringList values, rows;
-		QRegExp empty_val;
+		QByteArray aux_buffer=csv_buffer.toUtf8();
+		QBuffer buffer(&aux_buffer);
+		QStringList values;
 
-		//If no custom separator is specified we use the default ';'
-		aux_buffer.replace(QString("\r\n"), placeholder);
-		rows=aux_buffer.split(QChar::LineFeed, QString::SkipEmptyParts);
-		rows.replaceInStrings(placeholder, QString("\r\n"));
+		buffer.open(QBuffer::ReadOnly);
+		CsvReader reader(&buffer, separator, text_delim);
 
 		if(cols_in_first_row)
-		{
-			csv_cols=rows[0].split(separator);
-			csv_cols.replaceInStrings(text_delim, QString());
-			rows.removeAt(0);
-		}
-
-		//Configuring an regexp to remove empty quoted values, e.g, "",
-		if(!text_delim.isEmpty())
-			empty_val = QRegExp(QString("(\\%1\\%1)(\\%2)").arg(text_delim).arg(separator));
-
-		for(QString row : rows)
-		{
-			if(!empty_val.pattern().isEmpty())
-				row.replace(empty_val, separator);
-
-			/* In order to preserve double quotes (double delimiters) inside the values,
-			 we first replace them by a placeholder, erase the delimiters and restore the previous value */
-			row.replace(double_quote, placeholder);
-			row.replace(text_delim, QString());
-			row.replace(placeholder, double_quote);
-
-			values = row.split(separator);
-			for(int i =0; i < values.count(); i++)
-				values[i] = values[i].trimmed();
+			reader.readRow(csv_cols);
 
+		while(reader.readRow(values))
 			csv_rows.append(values);
-		}
 	}
 
 	return (csv_rows);
@@ -132,7 +145,7 @@ QList<QStringList> CsvLoadWidget::loadCsvFromBuffer(const QString &csv_buffer, c
 void CsvLoadWidget::loadCsvFile(void)
 {
 	QFile file;
-	QString csv_buffer;
+	QStringList separators={ QString(";"), QString(","), QString(" "), QString("\t") };
 
 	file.setFileName(file_edt->text());
 
@@ -141,19 +154,17 @@ void CsvLoadWidget::loadCsvFile(void)
 										ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	csv_columns.clear();
-	csv_rows.clear();
-
-	csv_buffer.append(file.readAll());
-
-	if(!csv_buffer.isEmpty())
+	separators += (separator_edt->text().isEmpty() ? QString(";") : separator_edt->text());
+	separator = separators[separator_cmb->currentIndex()];
+	text_delim = txt_delim_chk->isChecked() ? txt_delim_edt->text() : QString();
+	cols_in_first_row = col_names_chk->isChecked();
+	csv_filename = file_edt->text();
+
+	//Only the column names are extracted here, the rows are read from the file on demand
+	if(cols_in_first_row)
 	{
-		QString separator;
-		QStringList separators={ QString(";"), QString(","), QString(" "), QString("\t") };
-		separators += (separator_edt->text().isEmpty() ? QString(";") : separator_edt->text());
-		separator = separators[separator_cmb->currentIndex()];
-		csv_rows = loadCsvFromBuffer(csv_buffer, separator,
-																 txt_delim_chk->isChecked() ? txt_delim_edt->text() : QString(),
-																 col_names_chk->isChecked(), csv_columns);
+		CsvReader reader(&file, separator, text_delim);
+		reader.readRow(csv_columns);
 	}
 
 	file_edt->clear();
@@ -173,7 +184,7 @@ QString CsvLoadWidget::getCsvBuffer(QString separator, QString line_break)
 
 	buffer+=csv_columns.join(separator) + line_break;
 
-	for(QStringList row : csv_rows)
+	for(QStringList row : getCsvRows())
 		rows+=row.join(separator);
 
 	buffer+=rows.join(line_break);
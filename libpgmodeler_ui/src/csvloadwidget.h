@@ -27,6 +27,7 @@
 
 #include "ui_csvloadwidget.h"
 #include "hinttextwidget.h"
+#include "csvreader.h"
 #include <QWidget>
 
 class CsvLoadWidget : public QWidget, Ui::CsvLoadWidget {
@@ -38,8 +39,12 @@ class CsvLoadWidget : public QWidget, Ui::CsvLoadWidget {
 		//! \brief Holds the names of columns extracted from the csv file
 		QStringList csv_columns;
 
-		//! \brief Holds the rows extracted from the csv file
-		QList<QStringList> csv_rows;
+		/*! \brief Holds the file, value separator and text delimiter used in the last load. The rows aren't kept in memory,
+		instead, they are parsed from the file only when requested, this way huge files can be handled */
+		QString csv_filename, separator, text_delim;
+
+		//! \brief Indicates if the first row of the loaded file holds the column names
+		bool cols_in_first_row;
 
 	public:
 		CsvLoadWidget(QWidget * parent = 0, bool cols_in_first_row = true);
@@ -47,9 +52,18 @@ class CsvLoadWidget : public QWidget, Ui::CsvLoadWidget {
 		//! \brief Returns the extracted columns
 		QStringList getCsvColumns(void);
 
-		//! \brief Returns the extracted rows
+		//! \brief Returns the rows of the loaded file (parsed at each call)
 		QList<QStringList> getCsvRows(void);
 
+		//! \brief Returns the loaded file name (empty if no file was loaded)
+		QString getCsvFilename(void);
+
+		//! \brief Returns the value separator used to load the file
+		QString getSeparator(void);
+
+		//! \brief Returns the text delimiter used to load the file (empty if the values are not delimited)
+		QString getTextDelimiter(void);
+
 		//! \brief Returns a formatted CSV buffer by specifying a custom separator and line break
 		QString getCsvBuffer(QString separator, QString line_break);
 
@@ -0,0 +1,216 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "cursortablemodel.h"
+#include "sqlexecutionwidget.h"
+
+const QString CursorTableModel::CURSOR_NAME=QString("pgmodeler_data_cursor");
+
+CursorTableModel::CursorTableModel(QObject *parent) : QAbstractTableModel(parent)
+{
+	row_count=0;
+}
+
+CursorTableModel::~CursorTableModel(void)
+{
+	//Closing the connection finishes the cursor's transaction
+	connection.close();
+}
+
+void CursorTableModel::openCursor(const attribs_map &conn_params, const QString &query, Catalog &catalog)
+{
+	try
+	{
+		ResultSet res;
+
+		closeCursor();
+		beginResetModel();
+
+		connection.setConnectionParams(conn_params);
+		connection.connect();
+
+		/* Cursors without hold live only inside a transaction so it's kept open while the
+		cursor is browsed. The transaction is finished when the connection is closed */
+		connection.executeDDLCommand(QString("BEGIN"));
+		connection.executeDDLCommand(QString("DECLARE %1 SCROLL CURSOR FOR %2").arg(CURSOR_NAME).arg(query));
+
+		//Moving through all tuples in order to know the cursor's size (the tuples aren't transfered)
+		connection.executeDMLCommand(QString("MOVE ALL IN %1").arg(CURSOR_NAME), res);
+		row_count=res.getTupleCount();
+
+		//The first page is always fetched since it's the one used to configure the columns
+		ResultSet &first_page=getPage(0);
+
+		col_names=first_page.getColumnNames();
+		col_types=SQLExecutionWidget::getColumnTypeNames(catalog, first_page);
+
+		for(int col=0; col < col_names.size(); col++)
+			binary_cols.push_back(first_page.isColumnBinaryFormat(col));
+
+		endResetModel();
+	}
+	catch(Exception &e)
+	{
+		endResetModel();
+		closeCursor();
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void CursorTableModel::closeCursor(void)
+{
+	if(!connection.isStablished() && pages.empty())
+		return;
+
+	beginResetModel();
+	connection.close();
+	pages.clear();
+	lru_pages.clear();
+	col_names.clear();
+	col_types.clear();
+	binary_cols.clear();
+	row_count=0;
+	endResetModel();
+}
+
+bool CursorTableModel::isCursorOpen(void)
+{
+	return(connection.isStablished());
+}
+
+QString CursorTableModel::getColumnTypeName(int column) const
+{
+	if(column < 0 || column >= col_types.size())
+		throw Exception(ERR_REF_ELEM_INV_INDEX ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	return(col_types.at(column));
+}
+
+ResultSet &CursorTableModel::getPage(int page) const
+{
+	map<int, ResultSet>::iterator itr=pages.find(page);
+
+	if(itr!=pages.end())
+	{
+		//Marking the page as the most recently used
+		if(lru_pages.front()!=page)
+		{
+			lru_pages.remove(page);
+			lru_pages.push_front(page);
+		}
+
+		return(itr->second);
+	}
+
+	try
+	{
+		ResultSet res;
+
+		//Positioning the cursor just before the first tuple of the page and fetching it
+		connection.executeDDLCommand(QString("MOVE ABSOLUTE %1 IN %2").arg(page * PAGE_SIZE).arg(CURSOR_NAME));
+		connection.executeDMLCommand(QString("FETCH FORWARD %1 FROM %2").arg(PAGE_SIZE).arg(CURSOR_NAME), res);
+
+		//Discarding the least recently used page when the maximum amount of pages is reached
+		if(pages.size() >= static_cast<unsigned>(MAX_PAGES))
+		{
+			pages.erase(lru_pages.back());
+			lru_pages.pop_back();
+		}
+
+		lru_pages.push_front(page);
+		pages[page]=std::move(res);
+
+		return(pages[page]);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+int CursorTableModel::getPageCount(void) const
+{
+	return((row_count + PAGE_SIZE - 1) / PAGE_SIZE);
+}
+
+int CursorTableModel::rowCount(const QModelIndex &) const
+{
+	return(row_count);
+}
+
+int CursorTableModel::columnCount(const QModelIndex &) const
+{
+	return(col_names.size());
+}
+
+QVariant CursorTableModel::data(const QModelIndex &index, int role) const
+{
+	if(!index.isValid() || (role!=Qt::DisplayRole && role!=Qt::EditRole))
+		return(QVariant());
+
+	if(binary_cols[index.column()])
+		return(trUtf8("[binary data]"));
+
+	try
+	{
+		ResultSet &page=getPage(index.row() / PAGE_SIZE);
+		QByteArray value;
+
+		if(!page.setCurrentTuple(index.row() % PAGE_SIZE))
+			return(QVariant());
+
+		value=page.getColumnData(index.column());
+		return(QString::fromUtf8(value.constData(), value.size()));
+	}
+	catch(Exception &)
+	{
+		/* Errors while fetching a page (e.g. connection lost) can't be raised from here since the view
+		is painting the items, so the item is shown empty and the page will be requested again next time */
+		return(QVariant());
+	}
+}
+
+QVariant CursorTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+	if(orientation==Qt::Vertical)
+	{
+		if(role==Qt::DisplayRole)
+			return(QString::number(section + 1));
+	}
+	else if(section >= 0 && section < col_names.size())
+	{
+		if(role==Qt::DisplayRole)
+			return(col_names.at(section));
+		else if(role==Qt::ToolTipRole)
+			return(col_names.at(section) + QString(" [%1]").arg(col_types.at(section)));
+		else if(role==Qt::UserRole)
+			return(col_types.at(section));
+		else if(role==Qt::TextAlignmentRole)
+			return(static_cast<int>(Qt::AlignLeft | Qt::AlignVCenter));
+	}
+
+	return(QVariant());
+}
+
+Qt::ItemFlags CursorTableModel::flags(const QModelIndex &index) const
+{
+	if(!index.isValid())
+		return(Qt::NoItemFlags);
+
+	return(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
+}
@@ -0,0 +1,97 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class CursorTableModel
+\brief Implements a read-only table model that exposes the tuples of a query through a server-side cursor.
+The tuples are fetched in pages only when the view needs them and just a limited amount of pages are kept
+in memory (the least recently used ones are discarded) so arbitrarily large results can be browsed with bounded memory.
+*/
+
+#ifndef CURSOR_TABLE_MODEL_H
+#define CURSOR_TABLE_MODEL_H
+
+#include <QAbstractTableModel>
+#include "catalog.h"
+#include <list>
+
+class CursorTableModel: public QAbstractTableModel {
+	private:
+		Q_OBJECT
+
+		//! \brief Name of the cursor declared on the server
+		static const QString CURSOR_NAME;
+
+		/*! \brief Dedicated connection in which the cursor lives. The cursor's transaction is kept
+		open until closeCursor() is called (or the model is destroyed) */
+		mutable Connection connection;
+
+		//! \brief Amount of tuples returned by the cursor's query
+		int row_count;
+
+		//! \brief Names and data types of the cursor's columns
+		QStringList col_names, col_types;
+
+		//! \brief Indicates which columns are in binary format (those ones are not displayed)
+		vector<bool> binary_cols;
+
+		//! \brief Pages fetched from the cursor (page index -> tuples)
+		mutable map<int, ResultSet> pages;
+
+		//! \brief Indexes of the fetched pages ordered from the most to the least recently used
+		mutable list<int> lru_pages;
+
+	public:
+		//! \brief Amount of tuples fetched at once from the cursor
+		static const int PAGE_SIZE=500;
+
+		//! \brief Maximum amount of pages kept in memory
+		static const int MAX_PAGES=20;
+
+		CursorTableModel(QObject *parent = 0);
+		~CursorTableModel(void);
+
+		/*! \brief Declares a cursor for the provided query using a new connection configured with the provided params.
+		The catalog is used to retrieve the data type names of the columns. The cursor previously opened is closed */
+		void openCursor(const attribs_map &conn_params, const QString &query, Catalog &catalog);
+
+		//! \brief Closes the cursor and its connection discarding all fetched tuples
+		void closeCursor(void);
+
+		//! \brief Returns if the model has a cursor opened
+		bool isCursorOpen(void);
+
+		//! \brief Returns the data type name of the specified column
+		QString getColumnTypeName(int column) const;
+
+		/*! \brief Returns the page with the specified index fetching it from the cursor when it's not in memory.
+		When the maximum amount of pages is reached the least recently used one is discarded */
+		ResultSet &getPage(int page) const;
+
+		//! \brief Returns the amount of pages needed to hold all the cursor's tuples
+		int getPageCount(void) const;
+
+		int rowCount(const QModelIndex &parent = QModelIndex()) const;
+		int columnCount(const QModelIndex &parent = QModelIndex()) const;
+		QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+		QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+		Qt::ItemFlags flags(const QModelIndex &index) const;
+};
+
+#endif
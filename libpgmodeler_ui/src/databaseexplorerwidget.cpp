@@ -103,6 +103,11 @@ DatabaseExplorerWidget::DatabaseExplorerWidget(QWidget *parent): QWidget(parent)
 	properties_tbw->setItemDelegate(new PlainTextItemDelegate(this, true));
 	rename_item=nullptr;
 
+	/* The objects' names and attributes retrieved from the catalog are kept in memory so expanding
+	the tree and displaying properties don't need to query the server again while the database is unchanged */
+	import_helper.enableMetadataCache(true);
+	catalog.enableMetadataCache(true);
+
 	data_grid_tb->setToolTip(data_grid_tb->toolTip() + QString(" (%1)").arg(data_grid_tb->shortcut().toString()));
 	runsql_tb->setToolTip(runsql_tb->toolTip() + QString(" (%1)").arg(runsql_tb->shortcut().toString()));
 	refresh_tb->setToolTip(refresh_tb->toolTip() + QString(" (%1)").arg(refresh_tb->shortcut().toString()));
@@ -222,7 +227,7 @@ bool DatabaseExplorerWidget::eventFilter(QObject *object, QEvent *event)
 				}
 			}
 			else if(k_event->key()==Qt::Key_F5)
-				updateItem(objects_trw->currentItem());
+				updateItem(objects_trw->currentItem(), true);
 			else if(k_event->key()==Qt::Key_F2)
 				startObjectRename(objects_trw->currentItem());
 			else if(k_event->key()==Qt::Key_F7)
@@ -867,6 +872,10 @@ QString DatabaseExplorerWidget::getObjectName(ObjectType obj_type, const QString
 
 void DatabaseExplorerWidget::setConnection(Connection conn, const QString &default_db)
 {
+	//Closing the connections opened to the previous database so they can be reconfigured on the next listing
+	import_helper.closeConnection();
+	catalog.closeConnection();
+
 	this->connection=conn;
 	this->default_db=(default_db.isEmpty() ? QString("postgres") : default_db);
 }
@@ -892,6 +901,12 @@ void DatabaseExplorerWidget::listObjects(void)
 		bool quick_refresh=(act ? act->data().toBool() : true);
 
 		configureImportHelper();
+
+		/* Listing the whole database is an explicit refresh so this is the only moment the cached metadata
+		is checked against the server. Expanding nodes and showing properties reuse the cached results */
+		if(import_helper.validateMetadataCache())
+			catalog.reloadCatalogInfo();
+
 		objects_trw->blockSignals(true);
 
 		clearObjectProperties();
@@ -918,9 +933,6 @@ void DatabaseExplorerWidget::listObjects(void)
 		QApplication::restoreOverrideCursor();
 
 		objects_trw->blockSignals(false);
-
-		import_helper.closeConnection();
-		catalog.closeConnection();
 	}
 	catch(Exception &e)
 	{
@@ -931,13 +943,18 @@ void DatabaseExplorerWidget::listObjects(void)
 
 void DatabaseExplorerWidget::configureImportHelper(void)
 {
-	import_helper.setConnection(connection);
-	import_helper.setCurrentDatabase(connection.getConnectionParam(Connection::PARAM_DB_NAME));
+	/* The catalog connections are opened only once and kept opened while the database is browsed.
+	They are reopened only when closed, dropped by the server or timed out */
+	if(!import_helper.isConnectionStablished())
+		import_helper.setConnection(connection);
+
 	import_helper.setImportOptions(sys_objs_chk->isChecked(), ext_objs_chk->isChecked(), false, false, false, false, false);
 
-	catalog.closeConnection();
-	catalog.setFilter(Catalog::LIST_ALL_OBJS);
-	catalog.setConnection(connection);
+	if(!catalog.isConnectionStablished())
+	{
+		catalog.setFilter(Catalog::LIST_ALL_OBJS);
+		catalog.setConnection(connection);
+	}
 }
 
 void DatabaseExplorerWidget::handleObject(QTreeWidgetItem *item, int)
@@ -999,7 +1016,7 @@ void DatabaseExplorerWidget::handleObject(QTreeWidgetItem *item, int)
 		else if(exec_action==truncate_action || exec_action==trunc_cascade_action)
 			truncateTable(item,  exec_action==trunc_cascade_action);
 		else if(exec_action==refresh_action)
-			updateItem(objects_trw->currentItem());
+			updateItem(objects_trw->currentItem(), true);
 		else if(exec_action==rename_action)
 			startObjectRename(item);
 		else if(exec_action==properties_action)
@@ -1171,6 +1188,7 @@ void DatabaseExplorerWidget::dropObject(QTreeWidgetItem *item, bool cascade)
 				conn=connection;
 				conn.connect();
 				conn.executeDDLCommand(drop_cmd);
+				Catalog::clearMetadataCache(connection.getConnectionId(true, true));
 
 				//Updates the object count on the parent item
 				parent=item->parent();
@@ -1251,7 +1269,7 @@ void DatabaseExplorerWidget::truncateTable(QTreeWidgetItem *item, bool cascade)
 	}
 }
 
-void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item)
+void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool force_refresh)
 {
 	if(item && item->data(DatabaseImportForm::OBJECT_ID, Qt::UserRole).toInt() >= 0)
 	{
@@ -1263,6 +1281,9 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item)
 
 		QApplication::setOverrideCursor(Qt::WaitCursor);
 
+		if(force_refresh)
+			Catalog::clearMetadataCache(connection.getConnectionId(true, true));
+
 		if(obj_type==OBJ_DATABASE)
 			listObjects();
 		else
@@ -1320,7 +1341,6 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item)
 				}
 			}
 
-			import_helper.closeConnection();
 			objects_trw->sortItems(0, Qt::AscendingOrder);
 			objects_trw->setCurrentItem(nullptr);
 
@@ -1357,7 +1377,7 @@ void DatabaseExplorerWidget::loadObjectProperties(bool force_reload)
 			if(orig_attribs.empty() || force_reload)
 			{
 				QApplication::setOverrideCursor(Qt::WaitCursor);
-				catalog.setConnection(connection);
+				configureImportHelper();
 
 				//Loading the server properties
 				if(item == objects_trw->topLevelItem(0))
@@ -1409,7 +1429,6 @@ void DatabaseExplorerWidget::loadObjectProperties(bool force_reload)
 				if(item != objects_trw->topLevelItem(0))
 					item->setData(DatabaseImportForm::OBJECT_SOURCE, Qt::UserRole, DEFAULT_SOURCE_CODE);
 
-				catalog.closeConnection();
 				QApplication::restoreOverrideCursor();
 			}
 		}
@@ -1620,6 +1639,7 @@ void DatabaseExplorerWidget::finishObjectRename(void)
 			//Executes the rename cmd
 			conn.connect();
 			conn.executeDDLCommand(rename_cmd);
+			Catalog::clearMetadataCache(connection.getConnectionId(true, true));
 
 			rename_item->setFlags(rename_item->flags() ^ Qt::ItemIsEditable);
 			rename_item=nullptr;
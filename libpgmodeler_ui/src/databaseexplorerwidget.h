@@ -132,8 +132,9 @@ class DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplorerWidget
 		//! \brief Extract an attribute map containing the basic attributes for drop/rename commands
 		attribs_map extractAttributesFromItem(QTreeWidgetItem *item);
 
-		//! \brief Updates the selected tree item
-		void updateItem(QTreeWidgetItem *item);
+		/*! \brief Updates the selected tree item. When force_refresh is true the cached catalog metadata of the database
+		is discarded so the objects are retrieved again from the server (otherwise the cache is used while valid) */
+		void updateItem(QTreeWidgetItem *item, bool force_refresh=false);
 		
 		//! \brief Generate the SQL code for the specified object appending the permissions code for it as well
 		QString getObjectSource(BaseObject *object, DatabaseModel *dbmodel);
@@ -19,6 +19,7 @@
 #include "databaseimporthelper.h"
 
 const QString DatabaseImportHelper::UNKNOWN_OBJECT_OID_XML=QString("\t<!--[ unknown object OID=%1 ]-->\n");
+const unsigned DatabaseImportHelper::MAX_CATALOG_CONNS=4;
 
 DatabaseImportHelper::DatabaseImportHelper(QObject *parent) : QObject(parent)
 {
@@ -64,6 +65,28 @@ void DatabaseImportHelper::setCurrentDatabase(const QString &dbname)
 	}
 }
 
+void DatabaseImportHelper::enableMetadataCache(bool value)
+{
+	catalog.enableMetadataCache(value);
+}
+
+bool DatabaseImportHelper::isConnectionStablished(void)
+{
+	return(catalog.isConnectionStablished());
+}
+
+bool DatabaseImportHelper::validateMetadataCache(void)
+{
+	try
+	{
+		return(catalog.validateMetadataCache());
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 void DatabaseImportHelper::setSelectedOIDs(DatabaseModel *db_model, const map<ObjectType, vector<unsigned> > &obj_oids, const map<unsigned, vector<unsigned> > &col_oids)
 {
 	if(!db_model)
@@ -172,11 +195,32 @@ void DatabaseImportHelper::retrieveSystemObjects(void)
 	int progress=0;
 	vector<attribs_map>::iterator itr;
 	map<unsigned, attribs_map> *obj_map=nullptr;
-	vector<attribs_map> objects;
+	vector<function<vector<attribs_map>(Catalog &)>> queries;
+	vector<vector<attribs_map>> results;
 	ObjectType sys_objs[]={ OBJ_SCHEMA, OBJ_ROLE, OBJ_TABLESPACE,
 							OBJ_LANGUAGE, /* OBJ_COLLATION,*/ OBJ_TYPE };
 	unsigned i=0, oid=0, cnt=sizeof(sys_objs)/sizeof(ObjectType);
 
+	emit s_progressUpdated(progress, trUtf8("Retrieving system objects..."));
+
+	for(i=0; i < cnt; i++)
+	{
+		ObjectType obj_type=sys_objs[i];
+
+		queries.push_back([obj_type](Catalog &cat){
+			if(obj_type!=OBJ_TYPE && obj_type!=OBJ_LANGUAGE)
+				cat.setFilter(Catalog::LIST_ONLY_SYS_OBJS);
+			else
+				cat.setFilter(Catalog::LIST_ALL_OBJS);
+
+			return(cat.getObjectsAttributes(obj_type));
+		});
+	}
+
+	//Query the objects on the catalog in parallel and put them on the maps
+	runCatalogQueries(queries, results);
+	catalog.setFilter(Catalog::LIST_ALL_OBJS);
+
 	for(i=0; i < cnt && !import_canceled; i++)
 	{
 		emit s_progressUpdated(progress,
@@ -184,28 +228,17 @@ void DatabaseImportHelper::retrieveSystemObjects(void)
 							   sys_objs[i]);
 
 		if(sys_objs[i]!=OBJ_TYPE)
-		{
 			obj_map=&system_objs;
-
-			if(sys_objs[i]!=OBJ_LANGUAGE)
-				catalog.setFilter(Catalog::LIST_ONLY_SYS_OBJS);
-			else
-				catalog.setFilter(Catalog::LIST_ALL_OBJS);
-		}
 		else
-		{
 			obj_map=&types;
-			catalog.setFilter(Catalog::LIST_ALL_OBJS);
-		}
 
-		//Query the objects on the catalog and put them on the map
-		objects=catalog.getObjectsAttributes(sys_objs[i]);
-		itr=objects.begin();
+		itr=results[i].begin();
 
-		while(itr!=objects.end() && !import_canceled)
+		//The retrieved attributes are moved to the maps since the results are discarded afterwards
+		while(itr!=results[i].end() && !import_canceled)
 		{
 			oid=itr->at(ParsersAttributes::OID).toUInt();
-			(*obj_map)[oid]=(*itr);
+			(*obj_map)[oid]=std::move(*itr);
 			itr++;
 		}
 
@@ -216,54 +249,195 @@ void DatabaseImportHelper::retrieveSystemObjects(void)
 void DatabaseImportHelper::retrieveUserObjects(void)
 {
 	int progress=0;
-	map<ObjectType, vector<unsigned>>::iterator oid_itr=object_oids.begin();
 	vector<attribs_map>::iterator itr;
-	vector<attribs_map> objects;
-	unsigned i=0, oid=0;
-	map<unsigned, vector<unsigned>>::iterator col_itr;
+	vector<function<vector<attribs_map>(Catalog &)>> queries;
+	vector<vector<attribs_map>> results;
+	map<ObjectType, vector<unsigned>>::iterator oid_itr;
+	unsigned i=0, oid=0, tab_oid=0, filter=import_filter;
 	QStringList names;
 
-	i=0;
+	//Retrieving selected database level objects and table children objects (except columns)
+	for(auto &obj_oids : object_oids)
+	{
+		ObjectType obj_type=obj_oids.first;
+		vector<unsigned> oids=obj_oids.second;
+
+		queries.push_back([obj_type, oids, filter](Catalog &cat){
+			cat.setFilter(filter);
+			return(cat.getObjectsAttributes(obj_type, QString(), QString(), oids));
+		});
+	}
+
+	emit s_progressUpdated(progress, trUtf8("Retrieving objects..."));
+	runCatalogQueries(queries, results);
 	catalog.setFilter(import_filter);
 
-	//Retrieving selected database level objects and table children objects (except columns)
-	while(oid_itr!=object_oids.end() && !import_canceled)
+	for(oid_itr=object_oids.begin(), i=0; oid_itr!=object_oids.end() && !import_canceled; oid_itr++, i++)
 	{
 		emit s_progressUpdated(progress,
 								 trUtf8("Retrieving objects... `%1'").arg(BaseObject::getTypeName(oid_itr->first)),
 							   oid_itr->first);
 
-		objects=catalog.getObjectsAttributes(oid_itr->first, QString(), QString(), oid_itr->second);
-		itr=objects.begin();
+		itr=results[i].begin();
 
-		while(itr!=objects.end() && !import_canceled)
+		while(itr!=results[i].end() && !import_canceled)
 		{
 			oid=itr->at(ParsersAttributes::OID).toUInt();
-			user_objs[oid]=(*itr);
+			user_objs[oid]=std::move(*itr);
 			itr++;
 		}
 
-		objects.clear();
+		results[i].clear();
 		progress=(i/static_cast<float>(object_oids.size()))*100;
-		oid_itr++; i++;
 	}
 
-	//Retrieving all selected table columns
-	i=0;
-	col_itr=column_oids.begin();
-	while(col_itr!=column_oids.end())
-	{
-		emit s_progressUpdated(progress,
-								 trUtf8("Retrieving objects... `%1'").arg(BaseObject::getTypeName(OBJ_COLUMN)),
-							   OBJ_COLUMN);
+	/* Retrieving all selected table columns. This is done only after retrieving the other objects
+	because the tables' names are needed to query their columns */
+	queries.clear();
 
-		names=getObjectName(QString::number(col_itr->first)).split(".");
+	for(auto &col_itr : column_oids)
+	{
+		names=getObjectName(QString::number(col_itr.first)).split(".");
 
 		if(names.size() > 1)
-			retrieveTableColumns(names[0], names[1], col_itr->second);
+		{
+			QString sch_name=names[0], tab_name=names[1];
+			vector<unsigned> col_ids=col_itr.second;
 
-		progress=(i/static_cast<float>(column_oids.size()))*100;
-		col_itr++; i++;
+			queries.push_back([sch_name, tab_name, col_ids, filter](Catalog &cat){
+				cat.setFilter(filter);
+				return(cat.getObjectsAttributes(OBJ_COLUMN, sch_name, tab_name, col_ids));
+			});
+		}
+	}
+
+	if(import_canceled)
+		return;
+
+	emit s_progressUpdated(progress,
+							 trUtf8("Retrieving objects... `%1'").arg(BaseObject::getTypeName(OBJ_COLUMN)),
+						   OBJ_COLUMN);
+
+	runCatalogQueries(queries, results);
+	catalog.setFilter(import_filter);
+
+	for(i=0; i < results.size() && !import_canceled; i++)
+	{
+		for(auto &col_attribs : results[i])
+		{
+			oid=col_attribs.at(ParsersAttributes::OID).toUInt();
+			tab_oid=col_attribs.at(ParsersAttributes::TABLE).toUInt();
+			columns[tab_oid][oid]=std::move(col_attribs);
+		}
+
+		results[i].clear();
+		progress=(i/static_cast<float>(results.size()))*100;
+	}
+}
+
+void DatabaseImportHelper::runCatalogQueries(const vector<function<vector<attribs_map>(Catalog &)>> &queries, vector<vector<attribs_map>> &results)
+{
+	vector<Catalog *> catalogs;
+	vector<unsigned> cat_idxs;
+	vector<Exception> query_errors;
+	vector<unsigned char> query_failed;
+	QAtomicInt next_query(0);
+	QString snapshot_id;
+	unsigned conn_count=std::min<unsigned>(MAX_CATALOG_CONNS, queries.size()), idx=0;
+
+	results.clear();
+	results.resize(queries.size());
+
+	try
+	{
+		if(conn_count > 1)
+			snapshot_id=catalog.exportSnapshot();
+
+		//Without a shared snapshot the queries are executed in the main catalog only
+		if(snapshot_id.isEmpty())
+		{
+			for(idx=0; idx < queries.size() && !import_canceled; idx++)
+				results[idx]=queries[idx](catalog);
+
+			return;
+		}
+
+		/* The main catalog is used as the first worker, the others are copies of it so they have
+		the same filters, last system oid and extension objects list but their own connections */
+		cat_idxs.push_back(0);
+
+		for(idx=1; idx < conn_count; idx++)
+		{
+			catalogs.push_back(new Catalog(catalog));
+			cat_idxs.push_back(idx);
+		}
+
+		query_errors.resize(queries.size());
+		query_failed.resize(queries.size(), 0);
+
+		QtConcurrent::blockingMap(cat_idxs, [&](unsigned cat_idx){
+			Catalog *cat=(cat_idx==0 ? &catalog : catalogs[cat_idx - 1]);
+			int qry_idx=0;
+
+			try
+			{
+				if(cat_idx > 0)
+					cat->importSnapshot(snapshot_id);
+			}
+			catch(Exception &)
+			{
+				//If the snapshot can't be imported the worker is discarded and the others run its queries
+				return;
+			}
+
+			while(!import_canceled && (qry_idx=next_query.fetchAndAddOrdered(1)) < static_cast<int>(queries.size()))
+			{
+				try
+				{
+					results[qry_idx]=queries[qry_idx](*cat);
+				}
+				catch(Exception &e)
+				{
+					//The transaction of the worker is aborted after an error so it can't run further queries
+					query_errors[qry_idx]=e;
+					query_failed[qry_idx]=1;
+					break;
+				}
+			}
+		});
+
+		catalog.releaseSnapshot();
+		snapshot_id.clear();
+
+		while(!catalogs.empty())
+		{
+			delete(catalogs.back());
+			catalogs.pop_back();
+		}
+
+		//Raises the error of the first failed query (in the same order they would be executed sequentially)
+		for(idx=0; idx < queries.size(); idx++)
+		{
+			if(query_failed[idx])
+				throw Exception(query_errors[idx].getErrorMessage(), query_errors[idx].getErrorType(),
+												__PRETTY_FUNCTION__,__FILE__,__LINE__, &query_errors[idx]);
+		}
+	}
+	catch(Exception &e)
+	{
+		while(!catalogs.empty())
+		{
+			delete(catalogs.back());
+			catalogs.pop_back();
+		}
+
+		if(!snapshot_id.isEmpty())
+		{
+			try { catalog.releaseSnapshot(); }
+			catch(Exception &) {}
+		}
+
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
 }
 
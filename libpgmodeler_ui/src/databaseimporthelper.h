@@ -30,6 +30,8 @@
 #include "catalog.h"
 #include "modelwidget.h"
 #include <random>
+#include <functional>
+#include <QAtomicInt>
 
 class DatabaseImportHelper: public QObject {
 	private:
@@ -39,6 +41,9 @@ class DatabaseImportHelper: public QObject {
 		default_random_engine rand_num_engine;
 		
 		static const QString UNKNOWN_OBJECT_OID_XML;
+
+		//! \brief Maximum amount of connections (including the main catalog's one) used to query the catalog in parallel
+		static const unsigned MAX_CATALOG_CONNS;
 		
 		/*! \brief File handle to log the import process. This file is opened for writing only when
 		the 'ignore_errors' is true */
@@ -200,6 +205,12 @@ class DatabaseImportHelper: public QObject {
 		
 		//! \brief Clears the vectors and maps used in the import process
 		void resetImportParameters(void);
+
+		/*! \brief Runs the provided catalog queries distributing them among a pool of catalogs, each one with its own
+		connection, that share the snapshot exported by the main catalog so all of them see the database in the same state.
+		The results are stored in the same order of the queries. If the server doesn't support snapshot exporting
+		the queries are executed one after another using the main catalog */
+		void runCatalogQueries(const vector<function<vector<attribs_map>(Catalog &)>> &queries, vector<vector<attribs_map>> &results);
 		
 		//! \brief Return a string containing all attributes and their values in a formatted way
 		QString dumpObjectAttributes(attribs_map &attribs);
@@ -220,6 +231,16 @@ class DatabaseImportHelper: public QObject {
 		
 		//! \brief Set the current database to work on
 		void setCurrentDatabase(const QString &dbname);
+
+		//! \brief Enables/disables the metadata cache of the catalog used to retrieve the objects (see Catalog::enableMetadataCache())
+		void enableMetadataCache(bool value);
+
+		//! \brief Returns if the connection of the catalog used to retrieve the objects is opened
+		bool isConnectionStablished(void);
+
+		/*! \brief Discards the cached metadata of the current database if its catalog has changed (see Catalog::validateMetadataCache()).
+		Returns true when the cached metadata was discarded */
+		bool validateMetadataCache(void);
 		
 		//! \brief Defines the selected object to be imported. This method always expect filled maps. Hint: use the method Catalog::getObjectOIDs()
 		void setSelectedOIDs(DatabaseModel *db_model, const map<ObjectType, vector<unsigned>> &obj_oids, const map<unsigned, vector<unsigned>> &col_oids);
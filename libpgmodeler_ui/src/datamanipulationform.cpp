@@ -47,12 +47,19 @@ DataManipulationForm::DataManipulationForm(QWidget * parent, Qt::WindowFlags f):
 	code_compl_wgt->configureCompletion(nullptr, filter_hl);
 
 	results_tbw->setItemDelegate(new PlainTextItemDelegate(this, false));
+
+	cursor_model=new CursorTableModel(this);
+	results_tbv->setModel(cursor_model);
+	results_tbv->setItemDelegate(new PlainTextItemDelegate(this, true));
+	results_tbv->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+	results_tbv->setVisible(false);
+
 	browse_tabs_tb->setMenu(&fks_menu);
 
 	act = copy_menu.addAction(trUtf8("Copy as CSV"));
 	act->setShortcut(QKeySequence("Ctrl+C"));
 	connect(act, &QAction::triggered, [&](){
-		SQLExecutionWidget::copySelection(results_tbw, false, true);
+		SQLExecutionWidget::copySelection(getResultsView(), false, true);
 		has_csv_clipboard = true;
 		paste_tb->setEnabled(true);
 	});
@@ -60,7 +67,7 @@ DataManipulationForm::DataManipulationForm(QWidget * parent, Qt::WindowFlags f):
 	act = copy_menu.addAction(trUtf8("Copy as text"));
 	act->setShortcut(QKeySequence("Ctrl+Shift+C"));
 	connect(act, &QAction::triggered,	[&](){
-		SQLExecutionWidget::copySelection(results_tbw, false, false);
+		SQLExecutionWidget::copySelection(getResultsView(), false, false);
 		has_csv_clipboard = false;
 		paste_tb->setEnabled(true);
 	});
@@ -77,7 +84,7 @@ DataManipulationForm::DataManipulationForm(QWidget * parent, Qt::WindowFlags f):
 	result_info_wgt->setVisible(false);
 
 	//Forcing the splitter that handles the bottom widgets to resize its children to their minimum size
-	h_splitter->setSizes({500, 250, 500});
+	h_splitter->setSizes({500, 500, 250, 500});
 	v_splitter->setVisible(false);
 	csv_load_parent->setVisible(false);
 
@@ -131,8 +138,7 @@ DataManipulationForm::DataManipulationForm(QWidget * parent, Qt::WindowFlags f):
 	//Using the QueuedConnection here to avoid the "edit: editing failed" when editing and navigating through items using tab key
 	connect(results_tbw, SIGNAL(currentCellChanged(int,int,int,int)), this, SLOT(insertRowOnTabPress(int,int,int,int)), Qt::QueuedConnection);
 
-	connect(results_tbw, &QTableWidget::itemPressed,
-	[&](){
+	auto show_item_menu=[&](){
 					if(QApplication::mouseButtons()==Qt::RightButton)
 					{
 						QMenu item_menu;
@@ -145,7 +151,7 @@ DataManipulationForm::DataManipulationForm(QWidget * parent, Qt::WindowFlags f):
 						act = item_menu.addAction(QIcon(PgModelerUiNS::getIconPath("colar")), trUtf8("Pase items"));
 						act->setShortcut(paste_tb->shortcut());
 						connect(act, SIGNAL(triggered(bool)), paste_tb, SLOT(click()));
-						act->setEnabled(!qApp->clipboard()->text().isEmpty() && obj_type == OBJ_TABLE);
+						act->setEnabled(!qApp->clipboard()->text().isEmpty() && obj_type == OBJ_TABLE && !cursor_model->isCursorOpen());
 
 						if(obj_type == OBJ_TABLE)
 						{
@@ -164,13 +170,17 @@ DataManipulationForm::DataManipulationForm(QWidget * parent, Qt::WindowFlags f):
 
 						item_menu.exec(QCursor::pos());
 					}
-		});
+		};
+
+	connect(results_tbw, &QTableWidget::itemPressed, show_item_menu);
+	connect(results_tbv, &QTableView::pressed, show_item_menu);
 
 
 	connect(export_tb, &QToolButton::clicked,
-			[&](){ SQLExecutionWidget::exportResults(results_tbw); });
+			[&](){ SQLExecutionWidget::exportResults(getResultsView()); });
 
 	connect(results_tbw, SIGNAL(itemSelectionChanged()), this, SLOT(enableRowControlButtons()));
+	connect(results_tbv->selectionModel(), SIGNAL(selectionChanged(QItemSelection,QItemSelection)), this, SLOT(enableRowControlButtons()));
 	connect(csv_load_wgt, SIGNAL(s_csvFileLoaded()), this, SLOT(loadDataFromCsv()));
 }
 
@@ -302,6 +312,7 @@ void DataManipulationForm::retrieveData(void)
 		QString query=QString("SELECT * FROM \"%1\".\"%2\"").arg(schema_cmb->currentText()).arg(table_cmb->currentText());
 		ResultSet res;
 		unsigned limit=limit_spb->value();
+		int row_cnt=0;
 
 		//Building the where clause
 		if(!filter_txt->toPlainText().isEmpty())
@@ -330,29 +341,84 @@ void DataManipulationForm::retrieveData(void)
 		QApplication::setOverrideCursor(Qt::WaitCursor);
 
 		catalog.setConnection(conn_cat);
-		conn_sql.connect();
-		conn_sql.executeDMLCommand(query, res);
+		cursor_model->closeCursor();
+
+		/* When the amount of rows is unknown (no limit) or too big to be loaded in the grid the query
+		is opened as a cursor first. The cursor is kept only if the result is really bigger than the grid
+		supports, in that case the rows are browsed (read-only) through the cursor and fetched on demand */
+		if(limit==0 || limit > static_cast<unsigned>(MAX_GRID_ROWS))
+			cursor_model->openCursor(tmpl_conn_params, query, catalog);
 
 		retrievePKColumns(schema_cmb->currentText(), table_cmb->currentText());
 		retrieveFKColumns(schema_cmb->currentText(), table_cmb->currentText());
-		SQLExecutionWidget::fillResultsTable(catalog, res, results_tbw, true);
 
-		export_tb->setEnabled(results_tbw->rowCount() > 0);
-		result_info_wgt->setVisible(results_tbw->rowCount() > 0);
+		if(cursor_model->isCursorOpen() && cursor_model->rowCount() <= MAX_GRID_ROWS)
+		{
+			/* The result fits the grid so it's filled with the tuples fetched through the cursor instead of running
+			the query again. Since the grid's maximum size fits in the model's page limit no page is fetched twice.
+			The first page is always used (even when empty) since it configures the grid's columns */
+			for(int page=0; page < qMax(1, cursor_model->getPageCount()); page++)
+			{
+				if(page==0)
+					SQLExecutionWidget::fillResultsTable(catalog, cursor_model->getPage(page), results_tbw, true);
+				else
+					SQLExecutionWidget::appendResultsRows(cursor_model->getPage(page), results_tbw, true);
+			}
+
+			if(cursor_model->getPageCount() > 1)
+			{
+				results_tbw->resizeColumnsToContents();
+				results_tbw->resizeRowsToContents();
+			}
+
+			cursor_model->closeCursor();
+			row_cnt=results_tbw->rowCount();
+		}
+		else if(cursor_model->isCursorOpen())
+		{
+			row_cnt=cursor_model->rowCount();
+			results_tbw->setRowCount(0);
+			results_tbw->setColumnCount(0);
+
+			//Only the first page (already fetched) is used to size the columns, the rows have a fixed height
+			SQLExecutionWidget::resizeColumnsToRows(results_tbv, CursorTableModel::PAGE_SIZE);
+
+			hint_frm->setVisible(false);
+			add_tb->setEnabled(false);
+
+			if(table_cmb->currentData(Qt::UserRole).toUInt()==OBJ_TABLE)
+			{
+				warning_frm->setVisible(true);
+				warning_lbl->setText(trUtf8("The table has more rows than the grid can handle (%1) so they are being browsed in read-only mode. In order to edit the data define a limit of rows or a filter that returns up to %1 rows.").arg(MAX_GRID_ROWS));
+			}
+		}
+		else
+		{
+			conn_sql.connect();
+			conn_sql.executeDMLCommand(query, res);
+			SQLExecutionWidget::fillResultsTable(catalog, res, results_tbw, true);
+			row_cnt=results_tbw->rowCount();
+		}
+
+		results_tbw->setVisible(!cursor_model->isCursorOpen());
+		results_tbv->setVisible(cursor_model->isCursorOpen());
+
+		export_tb->setEnabled(row_cnt > 0);
+		result_info_wgt->setVisible(row_cnt > 0);
 		result_info_lbl->setText(QString("<em>[%1]</em> ").arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz"))) +
-								 trUtf8("Rows returned: <strong>%1</strong>&nbsp;&nbsp;&nbsp;").arg(results_tbw->rowCount()) +
+								 trUtf8("Rows returned: <strong>%1</strong>&nbsp;&nbsp;&nbsp;").arg(row_cnt) +
 								 trUtf8("<em>(Limit: <strong>%1</strong>)</em>").arg(limit_spb->value()==0 ? trUtf8("none") : QString::number(limit_spb->value())));
 
 		//Reset the changed rows state
 		clearChangedRows();
 
 		//If the table is empty automatically creates a new row
-		if(results_tbw->rowCount()==0 && table_cmb->currentData(Qt::UserRole).toUInt()==OBJ_TABLE)
+		if(row_cnt==0 && table_cmb->currentData(Qt::UserRole).toUInt()==OBJ_TABLE)
 			addRow();
 		else
-			results_tbw->setFocus();
+			getResultsView()->setFocus();
 
-		if(table_cmb->currentData(Qt::UserRole).toUInt()==OBJ_TABLE)
+		if(table_cmb->currentData(Qt::UserRole).toUInt()==OBJ_TABLE && !cursor_model->isCursorOpen())
 			csv_load_tb->setEnabled(!col_names.isEmpty());
 		else
 		{
@@ -367,7 +433,7 @@ void DataManipulationForm::retrieveData(void)
 
 		paste_tb->setEnabled(!qApp->clipboard()->text().isEmpty() &&
 												 table_cmb->currentData().toUInt() == OBJ_TABLE &&
-												 !col_names.isEmpty());
+												 !col_names.isEmpty() && !cursor_model->isCursorOpen());
 	}
 	catch(Exception &e)
 	{
@@ -383,6 +449,9 @@ void DataManipulationForm::disableControlButtons(void)
 	refresh_tb->setEnabled(schema_cmb->currentIndex() > 0 && table_cmb->currentIndex() > 0);
 	results_tbw->setRowCount(0);
 	results_tbw->setColumnCount(0);
+	results_tbw->setVisible(true);
+	results_tbv->setVisible(false);
+	cursor_model->closeCursor();
 	warning_frm->setVisible(false);
 	hint_frm->setVisible(false);
 	add_tb->setEnabled(false);
@@ -395,24 +464,26 @@ void DataManipulationForm::disableControlButtons(void)
 
 void DataManipulationForm::enableRowControlButtons(void)
 {
-	QList<QTableWidgetSelectionRange> sel_ranges=results_tbw->selectedRanges();
-	bool cols_selected, rows_selected;
+	QTableView *results_view=getResultsView();
+	QItemSelection sel_ranges=results_view->selectionModel()->selection();
+	bool cols_selected, rows_selected, editable=!cursor_model->isCursorOpen();
 
 	cols_selected = rows_selected = !sel_ranges.isEmpty();
 
 	for(auto &sel_rng : sel_ranges)
 	{
-		cols_selected &= (sel_rng.columnCount() == results_tbw->columnCount());
-		rows_selected &= (sel_rng.rowCount() == results_tbw->rowCount());
+		cols_selected &= (sel_rng.width() == results_view->model()->columnCount());
+		rows_selected &= (sel_rng.height() == results_view->model()->rowCount());
 	}
 
-	delete_tb->setEnabled(cols_selected);
-	duplicate_tb->setEnabled(cols_selected);
+	//Rows browsed through the cursor are read-only
+	delete_tb->setEnabled(editable && cols_selected);
+	duplicate_tb->setEnabled(editable && cols_selected);
 	copy_tb->setEnabled(sel_ranges.count() == 1);
-	paste_tb->setEnabled(!qApp->clipboard()->text().isEmpty() &&
+	paste_tb->setEnabled(editable && !qApp->clipboard()->text().isEmpty() &&
 											 table_cmb->currentData().toUInt() == OBJ_TABLE  &&
 											 !col_names.isEmpty());
-	browse_tabs_tb->setEnabled((!fk_infos.empty() || !ref_fk_infos.empty()) && sel_ranges.count() == 1 && sel_ranges.at(0).rowCount() == 1);
+	browse_tabs_tb->setEnabled((!fk_infos.empty() || !ref_fk_infos.empty()) && sel_ranges.count() == 1 && sel_ranges.at(0).height() == 1);
 }
 
 void DataManipulationForm::resetAdvancedControls(void)
@@ -495,6 +566,32 @@ void DataManipulationForm::loadDataFromCsv(bool load_from_clipboard)
 	}
 	else
 	{
+		//Tables can be filled directly from the file without passing the rows through the grid
+		if(table_cmb->currentData().toUInt()==OBJ_TABLE && !csv_load_wgt->getCsvFilename().isEmpty())
+		{
+			Messagebox msg_box;
+
+			msg_box.show(trUtf8("The rows of the file can be inserted directly in the table <strong>%1</strong> (faster, recommended for large files) or loaded into the grid so they can be reviewed before saving. How do you want to proceed?")
+									 .arg(table_cmb->currentText()),
+									 Messagebox::CONFIRM_ICON, Messagebox::YES_NO_BUTTONS,
+									 trUtf8("Bulk load"), trUtf8("Load into grid"), QString(),
+									 PgModelerUiNS::getIconPath("salvar"), PgModelerUiNS::getIconPath("loadcsv"));
+
+			if(msg_box.result()==QDialog::Accepted)
+			{
+				try
+				{
+					bulkLoadCsv();
+				}
+				catch(Exception &e)
+				{
+					msg_box.show(e);
+				}
+
+				return;
+			}
+		}
+
 		rows = csv_load_wgt->getCsvRows();
 		cols = csv_load_wgt->getCsvColumns();
 	}
@@ -547,6 +644,140 @@ void DataManipulationForm::loadDataFromCsv(bool load_from_clipboard)
 	}
 }
 
+void DataManipulationForm::bulkLoadCsv(void)
+{
+	TaskProgressWidget task_prog_wgt(this);
+	Connection conn=Connection(tmpl_conn_params);
+	Messagebox msg_box;
+	QFile file;
+	QStringList values, copy_cols=csv_load_wgt->getCsvColumns();
+	QByteArray buffer;
+	unsigned row_cnt=0;
+	int col_cnt=0, progress=0;
+	bool has_row=false, copy_started=false;
+
+	//Escapes the value according to the text format of COPY. Empty values are inserted as NULL
+	auto appendValue=[&](const QString &value){
+		if(value.isEmpty())
+		{
+			buffer.append("\\N");
+			return;
+		}
+
+		for(char chr : value.toUtf8())
+		{
+			if(chr=='\\')
+				buffer.append("\\\\");
+			else if(chr=='\t')
+				buffer.append("\\t");
+			else if(chr=='\n')
+				buffer.append("\\n");
+			else if(chr=='\r')
+				buffer.append("\\r");
+			else
+				buffer.append(chr);
+		}
+	};
+
+	try
+	{
+		file.setFileName(csv_load_wgt->getCsvFilename());
+
+		if(!file.open(QFile::ReadOnly))
+			throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED).arg(file.fileName()),
+											ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		CsvReader reader(&file, csv_load_wgt->getSeparator(), csv_load_wgt->getTextDelimiter());
+
+		//Skipping the row containing the column names
+		if(csv_load_wgt->isColumnsInFirstRow())
+			reader.readRow(values);
+
+		has_row=reader.readRow(values);
+
+		if(!has_row)
+			return;
+
+		//The column names in the file are used only if all of them exist in the table
+		for(auto &col : copy_cols)
+		{
+			if(!col_names.contains(col))
+			{
+				copy_cols.clear();
+				break;
+			}
+		}
+
+		//Otherwise, the values are copied to the table's columns in order of appearance
+		if(copy_cols.isEmpty())
+			copy_cols=col_names.mid(0, values.size());
+
+		col_cnt=copy_cols.size();
+
+		for(auto &col : copy_cols)
+			col=QString("\"%1\"").arg(col);
+
+		task_prog_wgt.setWindowTitle(trUtf8("Loading CSV file"));
+		task_prog_wgt.show();
+
+		conn.connect();
+		conn.startCopyIn(QString("COPY \"%1\".\"%2\"(%3) FROM STDIN")
+										 .arg(schema_cmb->currentText()).arg(table_cmb->currentText()).arg(copy_cols.join(QChar(','))));
+		copy_started=true;
+
+		while(has_row)
+		{
+			//Missing values are inserted as NULL and the exceeding ones are discarded
+			for(int col=0; col < col_cnt; col++)
+			{
+				if(col > 0)
+					buffer.append('\t');
+
+				appendValue(col < values.size() ? values.at(col) : QString());
+			}
+
+			buffer.append('\n');
+			row_cnt++;
+
+			if(buffer.size() >= COPY_CHUNK_SIZE)
+			{
+				conn.putCopyData(buffer);
+				buffer.clear();
+
+				if(progress!=reader.getProgress())
+				{
+					progress=reader.getProgress();
+					task_prog_wgt.updateProgress(progress, trUtf8("Copying rows to the table <strong>%1</strong>... (%2 rows sent)")
+																			 .arg(table_cmb->currentText()).arg(row_cnt), OBJ_TABLE);
+				}
+			}
+
+			has_row=reader.readRow(values);
+		}
+
+		if(!buffer.isEmpty())
+			conn.putCopyData(buffer);
+
+		row_cnt=conn.endCopyIn();
+		conn.close();
+		task_prog_wgt.close();
+
+		msg_box.show(trUtf8("<strong>%1</strong> row(s) inserted in the table <strong>%2</strong>.").arg(row_cnt).arg(table_cmb->currentText()),
+								 Messagebox::INFO_ICON, Messagebox::OK_BUTTON);
+
+		retrieveData();
+	}
+	catch(Exception &e)
+	{
+		//Aborting the copy so nothing is inserted
+		if(copy_started && conn.isStablished())
+			conn.endCopyIn(e.getErrorMessage());
+
+		task_prog_wgt.close();
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 void DataManipulationForm::removeColumnFromList(void)
 {
 	if(qApp->mouseButtons()==Qt::NoButton || qApp->mouseButtons()==Qt::LeftButton)
@@ -1069,6 +1300,7 @@ void DataManipulationForm::clearChangedRows(void)
 void DataManipulationForm::browseTable(const QString &fk_name, bool browse_ref_tab)
 {
 	QString value, schema, table;
+	QTableView *results_view = getResultsView();
 	DataManipulationForm *data_manip = new DataManipulationForm;
 	Connection conn = Connection(tmpl_conn_params);
 	QStringList filter, src_cols, ref_cols;
@@ -1090,7 +1322,7 @@ void DataManipulationForm::browseTable(const QString &fk_name, bool browse_ref_t
 
 	for(QString col_name : src_cols)
 	{
-		value = results_tbw->item(results_tbw->currentRow(), col_names.indexOf(col_name))->text();
+		value = results_view->model()->index(results_view->currentIndex().row(), col_names.indexOf(col_name)).data().toString();
 
 		if(value.isEmpty())
 			filter.push_back(QString("%1 IS NULL").arg(ref_cols.front()));
@@ -1353,3 +1585,11 @@ QString DataManipulationForm::getDMLCommand(int row)
 
 	return(fmt_cmd);
 }
+
+QTableView *DataManipulationForm::getResultsView(void)
+{
+	if(cursor_model->isCursorOpen())
+		return(results_tbv);
+
+	return(results_tbw);
+}
@@ -30,6 +30,8 @@
 #include "syntaxhighlighter.h"
 #include "codecompletionwidget.h"
 #include "csvloadwidget.h"
+#include "cursortablemodel.h"
+#include "taskprogresswidget.h"
 
 class DataManipulationForm: public QDialog, public Ui::DataManipulationForm {
 	private:
@@ -41,6 +43,10 @@ class DataManipulationForm: public QDialog, public Ui::DataManipulationForm {
 		//! \brief Default row colors for each operation type
 		static const QColor ROW_COLORS[3];
 
+		/*! \brief Maximum amount of rows loaded in the editable grid. Results bigger than that
+		are browsed through a server-side cursor in read-only mode (see CursorTableModel) */
+		static const int MAX_GRID_ROWS=10000;
+
 		static bool has_csv_clipboard;
 		
 		CsvLoadWidget *csv_load_wgt;
@@ -49,6 +55,9 @@ class DataManipulationForm: public QDialog, public Ui::DataManipulationForm {
 		
 		CodeCompletionWidget *code_compl_wgt;
 
+		//! \brief Model used to browse large results through a cursor
+		CursorTableModel *cursor_model;
+
 		QMenu fks_menu, copy_menu;
 		
 		//! \brief Store the template connection params to be used by catalogs and command execution connections
@@ -102,6 +111,13 @@ class DataManipulationForm: public QDialog, public Ui::DataManipulationForm {
 		//! brief Browse a referenced or referencing table by the provided foreign key name
 		void browseTable(const QString &fk_name, bool browse_ref_tab);
 
+		//! \brief Returns the view that is currently showing the results (the editable grid or the cursor's view)
+		QTableView *getResultsView(void);
+
+		/*! \brief Inserts the rows of the csv file loaded in csv_load_wgt directly in the current table using COPY.
+		The file is read in chunks so the rows are never held in memory and the grid isn't used at all */
+		void bulkLoadCsv(void);
+
 	public:
 		DataManipulationForm(QWidget * parent = 0, Qt::WindowFlags f = 0);
 		
@@ -3,6 +3,7 @@
 
 ModelExportHelper::ModelExportHelper(QObject *parent) : QObject(parent)
 {
+	batch_size=1;
 	resetExportParams();
 }
 
@@ -44,6 +45,11 @@ void ModelExportHelper::handleSQLError(Exception &e, const QString &sql_cmd, boo
 		errors.push_back(e);
 }
 
+void ModelExportHelper::setBatchSize(unsigned size)
+{
+	batch_size=(size==0 ? 1 : size);
+}
+
 void ModelExportHelper::setIgnoredErrors(const QStringList &err_codes)
 {
 	QRegExp valid_code = QRegExp("([a-z]|[A-Z]|[0-9])+");
@@ -95,7 +101,6 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 
 	try
 	{
-		QPixmap pix;
 		bool shw_grd, shw_dlm, align_objs;
 		QGraphicsView *view=nullptr;
 		QRect retv;
@@ -174,50 +179,85 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 
 		QPainter painter;
 		vector<QRectF>::iterator itr=pages.begin(), itr_end=pages.end();
+		vector<QImage> strips;
+		unsigned max_strips=qMax(1, QThread::idealThreadCount());
+		int strip_height, y;
 
-		while(itr!=itr_end && !export_canceled)
+		try
 		{
-			//Convert the objects bounding rect to viewport coordinates to correctly draw them onto pixmap
-			pol=view->mapFromScene(*itr);
-			itr++;
-
-			//Configure the viewport area to be copied
-			retv.setTopLeft(pol.at(0));
-			retv.setTopRight(pol.at(1));
-			retv.setBottomRight(pol.at(2));
-			retv.setBottomLeft(pol.at(3));
-
-			//Creates the output pixmap
-			pix=QPixmap(retv.size());
-			pix.fill();
-
-			//Setting optimizations on the painter
-			painter.begin(&pix);
-			painter.setRenderHint(QPainter::Antialiasing, true);
-			painter.setRenderHint(QPainter::TextAntialiasing, true);
-			painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
-
-			emit s_progressUpdated((page_idx/static_cast<float>(pages.size())) * 90,
-								   trUtf8("Rendering objects to page %1/%2.").arg(page_idx).arg(pages.size()), BASE_OBJECT);
-
-			//Render the entire viewport onto the pixmap
-			view->render(&painter, QRectF(QPointF(0,0), pix.size()), retv);
-			painter.end();
-
-			if(page_by_page)
-				file=tmpl_filename.arg(page_idx++);
-
-			//If the pixmap is not saved raises an error
-			if(!pix.save(file))
+			while(itr!=itr_end && !export_canceled)
 			{
-				//Restoring the scene settings before throw error
-				ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
-				scene->update();
+				//Convert the objects bounding rect to viewport coordinates to correctly draw them onto the image
+				pol=view->mapFromScene(*itr);
+				itr++;
+
+				//Configure the viewport area to be copied
+				retv.setTopLeft(pol.at(0));
+				retv.setTopRight(pol.at(1));
+				retv.setBottomRight(pol.at(2));
+				retv.setBottomLeft(pol.at(3));
+
+				if(page_by_page)
+					file=tmpl_filename.arg(page_idx);
+
+				/* Instead of rendering the whole area onto a single pixmap (which can be too big to be allocated
+				depending on the zoom and the model size) the area is rendered in strips of rows that are
+				handed to the png writer in batches, this way the memory usage doesn't depend on the image size
+				and the batches are compressed in parallel while being written to the file */
+				strip_height=qBound(1, MAX_STRIP_SIZE / (qMax(1, retv.width()) * 4), MAX_STRIP_HEIGHT);
+
+				{
+					PngWriter png(file, retv.width(), retv.height());
+
+					for(y=0; y < retv.height() && !export_canceled; y+=strip_height)
+					{
+						QImage strip(retv.width(), qMin(strip_height, retv.height() - y), QImage::Format_RGB32);
+						strip.fill(Qt::white);
+
+						//Setting optimizations on the painter
+						painter.begin(&strip);
+						painter.setRenderHint(QPainter::Antialiasing, true);
+						painter.setRenderHint(QPainter::TextAntialiasing, true);
+						painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+
+						//Render the portion of the viewport related to the current strip
+						view->render(&painter, QRectF(QPointF(0,0), strip.size()),
+												 QRect(retv.left(), retv.top() + y, retv.width(), strip.height()));
+						painter.end();
+						strips.push_back(strip);
+
+						if(strips.size()==max_strips || y + strip_height >= retv.height())
+						{
+							png.writeStrips(strips);
+							strips.clear();
+
+							emit s_progressUpdated(((page_idx - 1 + (png.getRowsWritten()/static_cast<float>(retv.height()))) / pages.size()) * 90,
+																		 trUtf8("Rendering objects to page %1/%2.").arg(page_idx).arg(pages.size()), BASE_OBJECT);
+						}
+					}
+
+					if(!export_canceled)
+						png.close();
+				}
+
+				//Removing the incomplete file
+				if(export_canceled)
+					QFile::remove(file);
 
-				throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(file),
-								ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				page_idx++;
 			}
 		}
+		catch(Exception &e)
+		{
+			//Restoring the scene settings before throw error
+			ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
+			scene->update();
+
+			if(view!=viewp)
+				delete(view);
+
+			throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		}
 
 		//Restoring the scene settings
 		ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
@@ -313,7 +353,7 @@ void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename
 void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, const QString &pgsql_ver, bool ignore_dup, bool drop_db, bool drop_objs, bool simulate, bool use_tmp_names)
 {
 	int type_id = 0, pos = -1;
-	QString  version, sql_cmd, buf, sql_cmd_comment;
+	QString  version, sql_cmd, sql_cmd_comment;
 	Connection new_db_conn;
 	unsigned i, count;
 	ObjectType types[]={OBJ_ROLE, OBJ_TABLESPACE};
@@ -513,9 +553,8 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 			emit s_progressUpdated(progress, trUtf8("Generating SQL for `%1' objects...").arg(db_model->getObjectCount()));
 
 			//Exporting the database model definition using the opened connection
-			buf=db_model->getCodeDefinition(SchemaParser::SQL_DEFINITION, false);
 			progress=40;
-			exportBufferToDBMS(buf, new_db_conn, drop_objs);
+			exportStatementsToDBMS(db_model->getSQLStatements(drop_objs), new_db_conn);
 		}
 
 		disconnect(db_model, nullptr, this, nullptr);
@@ -758,38 +797,30 @@ bool ModelExportHelper::isDuplicationError(const QString &error_code)
 
 void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &conn, bool drop_objs)
 {
-	Connection aux_conn;
-	QString sql_buf=buffer, sql_cmd, aux_cmd, lin, msg,
-			obj_name, obj_tp_name, tab_name,
-			alter_tab=QString("ALTER TABLE");
-	//vector<Exception> errors;
-	vector<QString> db_sql_cmds;
-	QTextStream ts;
-	ObjectType obj_type=BASE_OBJECT;
-	bool ddl_tk_found=false, is_create=false, is_drop=false;
-	unsigned aux_prog=0, curr_size=0, buf_size=sql_buf.size(),
-			factor=(db_name.isEmpty() ? 70 : 90);
-	int pos=0, pos1=0, comm_cnt=0;
+	vector<DatabaseModel::SQLStatement> stmts;
 
-	//Regexp used to extract the object being created
-	QRegExp obj_reg(QString("(CREATE|DROP|ALTER)(.)+(\n)")),
-			tab_obj_reg(QString("^(%1)(.)+(ADD|DROP)( )(COLUMN|CONSTRAINT)( )*").arg(alter_tab)),
-			drop_reg(QString("^((\\-\\-)+( )*)+(DROP)(.)+")),
-			drop_tab_obj_reg(QString("^((\\-\\-)+( )*)+(%1)(.)+(DROP)(.)+").arg(alter_tab)),
-			reg_aux;
+	//The raw buffer has no objects attached so the statements are identified by their code
+	DatabaseModel::splitSQLStatements(buffer, nullptr, drop_objs, stmts);
+	exportStatementsToDBMS(stmts, conn);
+}
 
-	vector<ObjectType> obj_types={ OBJ_ROLE, OBJ_FUNCTION, OBJ_TRIGGER, OBJ_INDEX,
-								   OBJ_RULE,	OBJ_TABLE, OBJ_VIEW, OBJ_DOMAIN,
-								   OBJ_SCHEMA,	OBJ_AGGREGATE, OBJ_OPFAMILY,
-								   OBJ_OPCLASS, OBJ_OPERATOR,  OBJ_SEQUENCE,
-								   OBJ_CONVERSION, OBJ_CAST,	OBJ_LANGUAGE,
-								   OBJ_COLLATION, OBJ_EXTENSION, OBJ_TYPE,
-								   OBJ_EVENT_TRIGGER, OBJ_DATABASE };
+void ModelExportHelper::exportStatementsToDBMS(const vector<DatabaseModel::SQLStatement> &stmts, Connection &conn)
+{
+	Connection aux_conn;
+	QString msg, sql_cmd;
+	vector<QString> db_sql_cmds, batch_cmds;
+	unsigned aux_prog=0, stmt_idx=0,
+			factor=(db_name.isEmpty() ? 70 : 90);
 
+	/* Runs the pending commands in batches (see setBatchSize()). Each failed command is handled separately
+	so the ignored error codes are respected and the exception raised by non ignored ones aborts the export */
+	auto executeBatch=[&](){
+		conn.executeDDLCommands(batch_cmds, batch_size, [&](unsigned cmd_idx, Exception &e){
+			handleSQLError(e, batch_cmds[cmd_idx], ignore_dup);
+		});
 
-	/* Extract each SQL command from the buffer and execute them separately. This is done
-   to permit the user, in case of error, identify what object is wrongly configured. */
-	ts.setString(&sql_buf);
+		batch_cmds.clear();
+	};
 
 	if(!conn.isStablished())
 	{
@@ -799,211 +830,69 @@ void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &co
 		conn.connect();
 	}
 
-	while(!ts.atEnd() && !export_canceled)
+	/* Each SQL command is executed separately (or in batches with a savepoint before each command). This is done
+	to permit the user, in case of error, identify what object is wrongly configured. */
+	for(auto &stmt : stmts)
 	{
+		if(export_canceled)
+			break;
+
+		sql_cmd=stmt.sql;
+
 		try
 		{
-			//Cleanup single line comments
-			lin=ts.readLine();
-			curr_size+=lin.size();
-			aux_prog=progress + ((curr_size/static_cast<float>(buf_size)) * factor);
-
-			/* If the simulation mode is off and the drop objects option is checked,
-		 check if the current line matches one of the accepted drop commands
-		 (DROP [OBJECT] or ALTER TABLE...DROP) */
-			if(drop_objs && (drop_reg.exactMatch(lin) || drop_tab_obj_reg.exactMatch(lin)))
-			{
-				comm_cnt=lin.count(QString("--"));
-				lin=lin.remove(QString("--")).trimmed();
+			aux_prog=progress + ((++stmt_idx/static_cast<float>(stmts.size())) * factor);
 
-				/* If the count of comment indicators (--) is 1 indicates that the DDL of the
-		   object related to the DROP is enabled, so the DROP is executed otherwise ignored */
-				if(comm_cnt==1)
-				{
-					sql_cmd=lin + QString("\n");
-					ddl_tk_found=true;
-				}
-			}
+			//General commands like grant, revoke or set aren't explicitly shown
+			if(stmt.obj_type==BASE_OBJECT || stmt.obj_type==OBJ_PERMISSION)
+				emit s_progressUpdated(aux_prog, trUtf8("Running auxiliary command."), BASE_OBJECT, sql_cmd);
 			else
 			{
-				ddl_tk_found=(lin.indexOf(ParsersAttributes::DDL_END_TOKEN) >= 0);
-				lin.remove(QRegExp(QString("^(--)+(.)+$")));
-
-				//If the line isn't empty after cleanup it will be included on sql command
-				if(!lin.isEmpty())
-					sql_cmd += lin + QString("\n");
+				if(stmt.is_drop || sql_cmd.trimmed().startsWith(QString("DROP")))
+					msg=trUtf8("Dropping object `%1' (%2)");
+				else if(sql_cmd.trimmed().startsWith(QString("CREATE")))
+					msg=trUtf8("Creating object `%1' (%2)");
+				else
+					msg=trUtf8("Changing object `%1' (%2)");
+
+				emit s_progressUpdated(aux_prog, msg.arg(stmt.obj_name).arg(BaseObject::getTypeName(stmt.obj_type)), stmt.obj_type, sql_cmd);
 			}
 
-			//If the ddl end token is found
-			if(ddl_tk_found || (!sql_cmd.isEmpty() && ts.atEnd()))
-			{
-				//Checking if the command is a column or constraint creation via ALTER TABLE
-				aux_cmd=sql_cmd;
-				pos=tab_obj_reg.indexIn(aux_cmd);
-
-				if(pos >= 0)
-				{
-					aux_cmd.remove('"');
-					aux_cmd.remove(QString("IF EXISTS "));
-					obj_type=(aux_cmd.contains(QString("COLUMN")) ? OBJ_COLUMN : OBJ_CONSTRAINT);
-					reg_aux=QRegExp(QString("(COLUMN|CONSTRAINT)( )+"));
-
-					//Extracting the table name
-					pos=aux_cmd.indexOf(alter_tab) + alter_tab.size();
-					pos1=aux_cmd.indexOf(QString("ADD"));
-
-					if(pos1 < 0)
-					{
-						pos1=aux_cmd.indexOf(QString("DROP"));
-						is_drop=true;
-					}
-
-					tab_name=aux_cmd.mid(pos, pos1 - pos).simplified();
-
-					//Extracting the child object name (column | constraint) the one between
-					pos=reg_aux.indexIn(aux_cmd, pos1);
-					pos+=reg_aux.matchedLength();
-
-					pos1=aux_cmd.indexOf(" ", pos);
-					obj_name=aux_cmd.mid(pos, pos1 - pos).simplified();
-
-					//Creating a fully qualified name for the object (schema.table.name)
-					obj_name=tab_name + QString(".") + obj_name;
-
-					if(is_drop)
-						msg=trUtf8("Dropping object `%1' (%2)").arg(obj_name).arg(BaseObject::getTypeName(obj_type));
-					else
-						msg=trUtf8("Creating object `%1' (%2)").arg(obj_name).arg(BaseObject::getTypeName(obj_type));
-
-					emit s_progressUpdated(aux_prog, msg, obj_type, sql_cmd);
-					is_drop=false;
-				}
-				//Check if the regex matches the sql command
-				else if(obj_reg.exactMatch(sql_cmd))
-				{
-					//Get the fisrt line of the sql command, that contains the CREATE/DROP/ALTER ... statement
-					lin=sql_cmd.mid(0, sql_cmd.indexOf('\n'));
-
-					for(ObjectType obj_tp : obj_types)
-					{
-						if(export_canceled) break;
-
-						obj_type=obj_tp;
-
-						//Appeding special tokens when the object is an index or view
-						if(lin.startsWith(QString("CREATE")) || lin.startsWith(QString("ALTER")))
-						{
-							if(obj_tp==OBJ_INDEX)
-							{
-								lin.remove(QString("UNIQUE"));
-								lin.remove(QString("CONCURRENTLY"));
-							}
-							else if(obj_tp==OBJ_VIEW)
-							{
-								lin.remove(QString("MATERIALIZED"));
-								lin.remove(QString("RECURSIVE"));
-							}
-							else if(obj_tp==OBJ_TABLE)
-							{
-								lin.remove(QString("UNLOGGED"));
-							}
-							else if(obj_tp==OBJ_FUNCTION)
-							{
-								lin.remove(QString("OR REPLACE"));
-							}
-						}
-						else if(lin.startsWith(QString("DROP")))
-						{
-							lin.remove(QString("IF EXISTS"));
-							lin.remove(QString("MATERIALIZED"));
-						}
-
-						lin=lin.simplified();
-
-						//Check if the keyword for the current object exists on string
-						reg_aux.setPattern(QString("(CREATE|DROP|ALTER)( )(%1)").arg(BaseObject::getSQLName(obj_tp)));
-						pos=reg_aux.indexIn(lin);
-
-						if(pos >= 0)
-						{
-							is_create=lin.startsWith(QString("CREATE"));
-							is_drop=(!is_create && lin.startsWith(QString("DROP")));
-
-							//Extracts from the line the string starting with the object's name
-							lin=lin.mid(reg_aux.matchedLength(), sql_cmd.indexOf('\n')).simplified();
-							lin.remove('"');
-
-							if(obj_tp!=OBJ_CAST)
-							{
-								int spc_idx=lin.indexOf(' ');
-								obj_name=lin.mid(0, (spc_idx >= 0 ? spc_idx + 1 : lin.size()));
-
-								if(obj_tp!=OBJ_FUNCTION)
-								{
-									obj_name=obj_name.remove('(').simplified();
-									obj_name=obj_name.remove(')').simplified();
-								}
-							}
-							else
-							{
-								obj_name=QString("cast") + lin.replace(QString(" AS "),QString(","));
-							}
-
-							//Stores the object type name
-							obj_tp_name=BaseObject::getTypeName(obj_tp);
-							obj_name.remove(';');
-
-							if(is_create)
-								msg=trUtf8("Creating object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
-							else if(is_drop)
-								msg=trUtf8("Dropping object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
-							else
-								msg=trUtf8("Changing object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
+			//Commands over the database itself are executed at the end of the process
+			if(stmt.obj_type!=OBJ_DATABASE)
+				batch_cmds.push_back(sql_cmd);
+			else
+				db_sql_cmds.push_back(sql_cmd);
+		}
+		catch(Exception &e)
+		{
+			handleSQLError(e, sql_cmd, ignore_dup);
+		}
 
-							break;
-						}
-					}
+		if(batch_cmds.size() >= batch_size)
+			executeBatch();
+	}
 
-					emit s_progressUpdated(aux_prog, msg, obj_type, sql_cmd);
-					is_create=is_drop=false;
-					msg.clear();
-				}
-				else if(!sql_cmd.trimmed().isEmpty())
-				{
-					//General commands like grant, revoke or set aren't explicitly shown
-					emit s_progressUpdated(aux_prog, trUtf8("Running auxiliary command."), BASE_OBJECT, sql_cmd);
-				}
+	if(!batch_cmds.empty() && !export_canceled)
+		executeBatch();
 
-				//Executes the extracted SQL command
-				if(!sql_cmd.isEmpty())
-				{
-					if(obj_type!=OBJ_DATABASE)
-						conn.executeDDLCommand(sql_cmd);
-					else
-						db_sql_cmds.push_back(sql_cmd);
-				}
+	if(!db_sql_cmds.empty() && !export_canceled)
+	{
+		conn.close();
+		aux_conn=conn;
+		aux_conn.connect();
 
-				sql_cmd.clear();
-				ddl_tk_found=false;
+		for(QString cmd : db_sql_cmds)
+		{
+			try
+			{
+				aux_conn.executeDDLCommand(cmd);
 			}
-
-			if(ts.atEnd() && !db_sql_cmds.empty())
+			catch(Exception &e)
 			{
-				conn.close();
-				aux_conn=conn;
-				aux_conn.connect();
-				for(QString cmd : db_sql_cmds)
-					aux_conn.executeDDLCommand(cmd);
+				handleSQLError(e, cmd, ignore_dup);
 			}
 		}
-		catch(Exception &e)
-		{
-			if(ddl_tk_found) ddl_tk_found=false;
-
-			handleSQLError(e, sql_cmd, ignore_dup);
-
-			sql_cmd.clear();
-		}
 	}
 
 	if(!db_name.isEmpty())
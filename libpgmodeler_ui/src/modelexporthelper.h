@@ -27,6 +27,7 @@
 
 #include "modelwidget.h"
 #include "connection.h"
+#include "pngwriter.h"
 
 class ModelExportHelper: public QObject {
 	private:
@@ -76,6 +77,9 @@ class ModelExportHelper: public QObject {
 		//! \brief List of ignored error codes
 		QStringList ignored_errors;
 
+		//! \brief Maximum amount of commands sent at once to the server when exporting to DBMS (see setBatchSize())
+		unsigned batch_size;
+
 		vector<Exception> errors;
 
 		/*! \brief Indicates which role / tablespaces were created on server (only dbms export).
@@ -118,6 +122,10 @@ class ModelExportHelper: public QObject {
 		//! \brief Exports the contents of the buffer to a previously opened connection
 		void exportBufferToDBMS(const QString &buffer, Connection &conn, bool drop_objs=false);
 
+		/*! \brief Executes the statements (in the provided order) using the connection, which is opened if needed.
+		Each statement is executed separately so the errors can be attributed to the object that generated it */
+		void exportStatementsToDBMS(const vector<DatabaseModel::SQLStatement> &stmts, Connection &conn);
+
 		//! \brief Returns if the error code is one of the treated by the export process as object duplication error
 		bool isDuplicationError(const QString &error_code);
 
@@ -135,6 +143,11 @@ class ModelExportHelper: public QObject {
 		void handleSQLError(Exception &e, const QString &sql_cmd, bool ignore_dup);
 
 	public:
+		/*! \brief Maximum amount of rows and bytes of each strip rendered when exporting to PNG.
+		The image is produced strip by strip so the memory used doesn't depend on its dimensions */
+		static const int MAX_STRIP_HEIGHT=256,
+		MAX_STRIP_SIZE=16777216;
+
 		ModelExportHelper(QObject *parent = 0);
 
 		/*! \brief Determines which error codes must be ignored during the export process.
@@ -143,6 +156,11 @@ class ModelExportHelper: public QObject {
 		Error catalog is available at: postgresql.org/docs/current/static/errcodes-appendix.html */
 		void setIgnoredErrors(const QStringList &err_codes);
 
+		/*! \brief Makes the DBMS export send up to 'size' commands at once to the server, each batch running in a transaction,
+		which reduces the time spent waiting the server's response for each command. The errors are still reported
+		(and ignored, when configured) per command. The default size is 1, meaning that each command is sent separately */
+		void setBatchSize(unsigned size);
+
 		//! \brief Exports the model to a named SQL file. The PostgreSQL version syntax must be specified.
 		void exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver);
 
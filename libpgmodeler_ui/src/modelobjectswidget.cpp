@@ -25,6 +25,7 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 	setupUi(this);
 	model_wgt=nullptr;
 	db_model=nullptr;
+	list_outdated=false;
 	setModel(db_model);
 
 	title_wgt->setVisible(!simplified_view);
@@ -41,8 +42,9 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 	splitter->handle(1)->setEnabled(false);
 
 	connect(objectstree_tw,SIGNAL(itemPressed(QTreeWidgetItem*,int)),this, SLOT(selectObject(void)));
+	connect(objectstree_tw,SIGNAL(itemExpanded(QTreeWidgetItem*)),this, SLOT(populateItem(QTreeWidgetItem*)));
 	connect(objectslist_tbw,SIGNAL(itemPressed(QTableWidgetItem*)),this, SLOT(selectObject(void)));
-	connect(expand_all_tb, SIGNAL(clicked(void)), objectstree_tw, SLOT(expandAll(void)));
+	connect(expand_all_tb, SIGNAL(clicked(void)), this, SLOT(expandAll(void)));
 	connect(collapse_all_tb, SIGNAL(clicked(void)), this, SLOT(collapseAll(void)));
 
 	if(!simplified_view)
@@ -217,6 +219,7 @@ QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTr
 	ConstraintType constr_type;
 	ObjectType obj_type;
 	TableObject *tab_obj=nullptr;
+	BaseObject *parent_obj=nullptr;
 	QString obj_name;
 
 	if(!object)
@@ -253,6 +256,11 @@ QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTr
 		obj_name=object->getName();
 	}
 
+	//Items of the objects referenced by tags are only shortcuts so they aren't indexed
+	parent_obj=(root ? reinterpret_cast<BaseObject *>(root->data(0, Qt::UserRole).value<void *>()) : nullptr);
+	if(!parent_obj || parent_obj->getObjectType()!=OBJ_TAG)
+		obj_tree_items[object]=item;
+
 	item->setToolTip(0, QString("%1 (id: %2)").arg(obj_name).arg(object->getObjectId()));
 	item->setData(0, Qt::UserRole, generateItemValue(object));
 	item->setText(1, QString::number(object->getObjectId()));
@@ -377,6 +385,14 @@ void ModelObjectsWidget::changeObjectsView(void)
 		tree_view_tb->setChecked(sender()==tree_view_tb);
 		list_view_tb->setChecked(sender()==list_view_tb);
 		by_id_chk->setEnabled(sender()==tree_view_tb);
+
+		if(sender()==list_view_tb && list_outdated)
+		{
+			updateObjectsList();
+
+			if(!filter_edt->text().isEmpty())
+				filterObjects();
+		}
 	}
 	else if(sender()==options_tb)
 	{
@@ -401,10 +417,21 @@ void ModelObjectsWidget::collapseAll(void)
 		root->setExpanded(true);
 }
 
+void ModelObjectsWidget::expandAll(void)
+{
+	//QTreeWidget::expandAll() doesn't emit itemExpanded() so the on demand items must be populated first
+	populateAllItems();
+	objectstree_tw->expandAll();
+}
+
 void ModelObjectsWidget::filterObjects(void)
 {
 	if(tree_view_tb->isChecked())
 	{
+		//The filtering needs all the items to be created since it searches the entire tree
+		if(!filter_edt->text().isEmpty())
+			populateAllItems();
+
 		DatabaseImportForm::filterObjects(objectstree_tw, filter_edt->text(), (by_id_chk->isChecked() ? 1 : 0), simplified_view);
 	}
 	else
@@ -428,7 +455,12 @@ void ModelObjectsWidget::filterObjects(void)
 void ModelObjectsWidget::updateObjectsView(void)
 {
 	updateDatabaseTree();
-	updateObjectsList();
+
+	//The list is updated only when visible since it holds all the model's objects at once
+	if(list_view_tb->isChecked())
+		updateObjectsList();
+	else
+		list_outdated=true;
 
 	if(!filter_edt->text().isEmpty())
 		filterObjects();
@@ -438,6 +470,8 @@ void ModelObjectsWidget::updateObjectsList(void)
 {
 	vector<BaseObject *> objects;
 
+	list_outdated=false;
+
 	if(db_model)
 	{
 		vector<ObjectType> visible_types;
@@ -459,15 +493,10 @@ void ModelObjectsWidget::updateSchemaTree(QTreeWidgetItem *root)
 {
 	if(db_model && visible_objs_map[OBJ_SCHEMA])
 	{
-		BaseObject *object=nullptr, *schema=nullptr;
-		vector<BaseObject *> obj_list;
+		BaseObject *schema=nullptr;
 		QFont font;
-		QTreeWidgetItem *item=nullptr, *item1=nullptr, *item2=nullptr, *item3=nullptr;
-		ObjectType types[]={ OBJ_FUNCTION, OBJ_AGGREGATE,
-							 OBJ_DOMAIN, OBJ_TYPE, OBJ_CONVERSION,
-							 OBJ_OPERATOR, OBJ_OPFAMILY, OBJ_OPCLASS,
-							 OBJ_SEQUENCE, OBJ_COLLATION, OBJ_EXTENSION };
-		int count, count2, type_cnt=sizeof(types)/sizeof(ObjectType), i, i1, i2;
+		QTreeWidgetItem *item=nullptr, *item1=nullptr;
+		int count, i;
 
 		QPixmap group_icon=QPixmap(PgModelerUiNS::getIconPath(QString(BaseObject::getSchemaName(OBJ_SCHEMA)) + QString("_grp")));
 
@@ -488,52 +517,64 @@ void ModelObjectsWidget::updateSchemaTree(QTreeWidgetItem *root)
 		{
 			for(i=0; i < count; i++)
 			{
-				//The first item is the public schema
-				if(i==-1)
-				{
-					//The new sub item to be configured will be the public schema item
-					item2=item1;
-					schema=nullptr;
-				}
-				else
-				{
-					schema=db_model->getObject(i,OBJ_SCHEMA);
-					item2=createItemForObject(schema, item);
-				}
+				schema=db_model->getObject(i,OBJ_SCHEMA);
+				item1=createItemForObject(schema, item);
 
-				//Updates the table subtree for the current schema
-				updateTableTree(item2, schema);
+				//The schema's subtrees (tables, views, functions, etc) are created only when the item is expanded
+				setItemPopulatedOnDemand(item1);
+			}
+		}
+		catch(Exception &e)
+		{
+			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		}
+	}
+}
 
-				//Updates the view subtree for the current schema
-				updateViewTree(item2, schema);
+void ModelObjectsWidget::updateSchemaItem(QTreeWidgetItem *root, BaseObject *schema)
+{
+	if(db_model)
+	{
+		vector<BaseObject *> obj_list;
+		QFont font;
+		QTreeWidgetItem *item=nullptr;
+		ObjectType types[]={ OBJ_FUNCTION, OBJ_AGGREGATE,
+							 OBJ_DOMAIN, OBJ_TYPE, OBJ_CONVERSION,
+							 OBJ_OPERATOR, OBJ_OPFAMILY, OBJ_OPCLASS,
+							 OBJ_SEQUENCE, OBJ_COLLATION, OBJ_EXTENSION };
+		int count, type_cnt=sizeof(types)/sizeof(ObjectType), i, i1;
+
+		try
+		{
+			//Updates the table subtree for the current schema
+			updateTableTree(root, schema);
+
+			//Updates the view subtree for the current schema
+			updateViewTree(root, schema);
 
-				//Creates the object group at schema level (function, domain, sequences, etc)
-				for(i1=0; i1 < type_cnt; i1++)
+			//Creates the object group at schema level (function, domain, sequences, etc)
+			for(i=0; i < type_cnt; i++)
+			{
+				if(visible_objs_map[types[i]])
 				{
-					if(visible_objs_map[types[i1]])
-					{
-						item3=new QTreeWidgetItem(item2);
-						item3->setIcon(0,QPixmap(PgModelerUiNS::getIconPath(BaseObject::getSchemaName(types[i1]) + QString("_grp"))));
+					item=new QTreeWidgetItem(root);
+					item->setIcon(0,QPixmap(PgModelerUiNS::getIconPath(BaseObject::getSchemaName(types[i]) + QString("_grp"))));
 
-						//Get the objects that belongs to the current schema
-						obj_list=db_model->getObjects(types[i1], schema);
+					//Get the objects that belongs to the current schema
+					obj_list=db_model->getObjects(types[i], schema);
 
-						count2=obj_list.size();
-						item3->setText(0,
-									   BaseObject::getTypeName(types[i1]) +
-									   QString(" (%1)").arg(count2));
-						item3->setData(1, Qt::UserRole, QVariant::fromValue<unsigned>(types[i1]));
+					count=obj_list.size();
+					item->setText(0,
+								  BaseObject::getTypeName(types[i]) +
+								  QString(" (%1)").arg(count));
+					item->setData(1, Qt::UserRole, QVariant::fromValue<unsigned>(types[i]));
 
-						font=item3->font(0);
-						font.setItalic(true);
-						item3->setFont(0, font);
+					font=item->font(0);
+					font.setItalic(true);
+					item->setFont(0, font);
 
-						for(i2=0; i2 < count2; i2++)
-						{
-							object=obj_list[i2];
-							createItemForObject(object, item3);
-						}
-					}
+					for(i1=0; i1 < count; i1++)
+						createItemForObject(obj_list[i1], item);
 				}
 			}
 		}
@@ -548,14 +589,10 @@ void ModelObjectsWidget::updateTableTree(QTreeWidgetItem *root, BaseObject *sche
 {
 	if(db_model && visible_objs_map[OBJ_TABLE])
 	{
-		BaseObject *object=nullptr;
 		vector<BaseObject *> obj_list;
-		Table *table=nullptr;
-		QTreeWidgetItem *item=nullptr, *item1=nullptr, *item2=nullptr;
+		QTreeWidgetItem *item=nullptr, *item1=nullptr;
 		QFont font;
-		ObjectType types[]={ OBJ_COLUMN, OBJ_CONSTRAINT, OBJ_RULE,
-												 OBJ_TRIGGER, OBJ_INDEX };
-		int count, count1, type_cnt=sizeof(types)/sizeof(ObjectType), i, i1, i2;
+		int count, i;
 		QPixmap group_icon=QPixmap(PgModelerUiNS::getIconPath(BaseObject::getSchemaName(OBJ_TABLE) + QString("_grp")));
 
 		try
@@ -577,31 +614,10 @@ void ModelObjectsWidget::updateTableTree(QTreeWidgetItem *root, BaseObject *sche
 			count=obj_list.size();
 			for(i=0; i < count; i++)
 			{
-				table=dynamic_cast<Table *>(obj_list[i]);
-				item1=createItemForObject(table, item);
+				item1=createItemForObject(obj_list[i], item);
 
-				//Creating the group for the child objects (column, rules, triggers, indexes and constraints)
-				for(i1=0; i1 < type_cnt; i1++)
-				{
-					if(visible_objs_map[types[i1]])
-					{
-						item2=new QTreeWidgetItem(item1);
-						item2->setIcon(0,QPixmap(PgModelerUiNS::getIconPath(BaseObject::getSchemaName(types[i1]) + QString("_grp"))));
-						font=item2->font(0);
-						font.setItalic(true);
-						item2->setFont(0, font);
-
-						count1=table->getObjectCount(types[i1]);
-						item2->setText(0,BaseObject::getTypeName(types[i1]) +
-									   QString(" (%1)").arg(count1));
-
-						for(i2=0; i2 < count1; i2++)
-						{
-							object=table->getObject(i2,types[i1]);
-							createItemForObject(object, item2);
-						}
-					}
-				}
+				//The groups for the child objects (column, rules, triggers, indexes and constraints) are created on demand
+				setItemPopulatedOnDemand(item1);
 			}
 		}
 		catch(Exception &e)
@@ -615,13 +631,10 @@ void ModelObjectsWidget::updateViewTree(QTreeWidgetItem *root, BaseObject *schem
 {
 	if(db_model && visible_objs_map[OBJ_VIEW])
 	{
-		BaseObject *object=nullptr;
 		vector<BaseObject *> obj_list;
-		View *view=nullptr;
-		QTreeWidgetItem *item=nullptr, *item1=nullptr, *item2=nullptr;
+		QTreeWidgetItem *item=nullptr, *item1=nullptr;
 		QFont font;
-		ObjectType types[]={ OBJ_RULE, OBJ_TRIGGER, OBJ_INDEX };
-		int count, count1, type_cnt=sizeof(types)/sizeof(ObjectType), i, i1, i2;
+		int count, i;
 		QPixmap group_icon=QPixmap(PgModelerUiNS::getIconPath(QString(BaseObject::getSchemaName(OBJ_VIEW)) + QString("_grp")));
 
 		try
@@ -643,30 +656,55 @@ void ModelObjectsWidget::updateViewTree(QTreeWidgetItem *root, BaseObject *schem
 			count=obj_list.size();
 			for(i=0; i < count; i++)
 			{
-				view=dynamic_cast<View *>(obj_list[i]);
-				item1=createItemForObject(view, item);
+				item1=createItemForObject(obj_list[i], item);
 
-				//Creating the group for the child objects (rules, triggers)
-				for(i1=0; i1 < type_cnt; i1++)
-				{
-					if(visible_objs_map[types[i1]])
-					{
-						item2=new QTreeWidgetItem(item1);
-						item2->setIcon(0,QPixmap(PgModelerUiNS::getIconPath(BaseObject::getSchemaName(types[i1]) + QString("_grp"))));
-						font=item2->font(0);
-						font.setItalic(true);
-						item2->setFont(0, font);
+				//The groups for the child objects (rules, triggers, indexes) are created on demand
+				setItemPopulatedOnDemand(item1);
+			}
+		}
+		catch(Exception &e)
+		{
+			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		}
+	}
+}
 
-						count1=view->getObjectCount(types[i1]);
-						item2->setText(0,BaseObject::getTypeName(types[i1]) +
-									   QString(" (%1)").arg(count1));
+void ModelObjectsWidget::updateTableItem(QTreeWidgetItem *root, BaseTable *table)
+{
+	if(!table)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-						for(i2=0; i2 < count1; i2++)
-						{
-							object=view->getObject(i2,types[i1]);
-							createItemForObject(object, item2);
-						}
-					}
+	if(db_model)
+	{
+		QTreeWidgetItem *item=nullptr;
+		QFont font;
+		vector<ObjectType> types;
+		unsigned count, i;
+
+		if(table->getObjectType()==OBJ_TABLE)
+			types={ OBJ_COLUMN, OBJ_CONSTRAINT, OBJ_RULE, OBJ_TRIGGER, OBJ_INDEX };
+		else
+			types={ OBJ_RULE, OBJ_TRIGGER, OBJ_INDEX };
+
+		try
+		{
+			//Creating the group for the child objects
+			for(auto &type : types)
+			{
+				if(visible_objs_map[type])
+				{
+					item=new QTreeWidgetItem(root);
+					item->setIcon(0,QPixmap(PgModelerUiNS::getIconPath(BaseObject::getSchemaName(type) + QString("_grp"))));
+					font=item->font(0);
+					font.setItalic(true);
+					item->setFont(0, font);
+
+					count=table->getObjectCount(type);
+					item->setText(0,BaseObject::getTypeName(type) +
+								  QString(" (%1)").arg(count));
+
+					for(i=0; i < count; i++)
+						createItemForObject(table->getObject(i, type), item);
 				}
 			}
 		}
@@ -677,6 +715,72 @@ void ModelObjectsWidget::updateViewTree(QTreeWidgetItem *root, BaseObject *schem
 	}
 }
 
+void ModelObjectsWidget::setItemPopulatedOnDemand(QTreeWidgetItem *item)
+{
+	if(item)
+	{
+		item->setData(0, Qt::UserRole + 1, true);
+		item->setChildIndicatorPolicy(QTreeWidgetItem::ShowIndicator);
+	}
+}
+
+bool ModelObjectsWidget::isItemPopulatedOnDemand(QTreeWidgetItem *item)
+{
+	return(item && item->data(0, Qt::UserRole + 1).toBool());
+}
+
+void ModelObjectsWidget::populateItem(QTreeWidgetItem *item)
+{
+	if(!isItemPopulatedOnDemand(item))
+		return;
+
+	BaseObject *object=reinterpret_cast<BaseObject *>(item->data(0, Qt::UserRole).value<void *>());
+
+	try
+	{
+		//Unmarking the item before creating the children to avoid populating it twice
+		item->setData(0, Qt::UserRole + 1, false);
+		item->setChildIndicatorPolicy(QTreeWidgetItem::DontShowIndicatorWhenChildless);
+
+		if(object->getObjectType()==OBJ_SCHEMA)
+			updateSchemaItem(item, object);
+		else
+			updateTableItem(item, dynamic_cast<BaseTable *>(object));
+
+		item->sortChildren(0, Qt::AscendingOrder);
+	}
+	catch(Exception &e)
+	{
+		Messagebox msg_box;
+		msg_box.show(e);
+	}
+}
+
+void ModelObjectsWidget::populateAllItems(void)
+{
+	vector<QTreeWidgetItem *> items;
+
+	/* Since populating an item can create other on demand items (e.g. the tables of a schema)
+	the tree is traversed until there are no more items to be populated */
+	do
+	{
+		QTreeWidgetItemIterator itr(objectstree_tw);
+
+		items.clear();
+		while(*itr)
+		{
+			if(isItemPopulatedOnDemand(*itr))
+				items.push_back(*itr);
+
+			++itr;
+		}
+
+		for(auto &item : items)
+			populateItem(item);
+	}
+	while(!items.empty());
+}
+
 void ModelObjectsWidget::updatePermissionTree(QTreeWidgetItem *root, BaseObject *object)
 {
 	try
@@ -710,7 +814,10 @@ void ModelObjectsWidget::updatePermissionTree(QTreeWidgetItem *root, BaseObject
 void ModelObjectsWidget::updateDatabaseTree(void)
 {
 	if(!db_model)
+	{
 		objectstree_tw->clear();
+		obj_tree_items.clear();
+	}
 	else
 	{
 		QString str_aux;
@@ -729,6 +836,7 @@ void ModelObjectsWidget::updateDatabaseTree(void)
 				saveTreeState(tree_state);
 
 			objectstree_tw->clear();
+			obj_tree_items.clear();
 
 			if(visible_objs_map[OBJ_DATABASE])
 			{
@@ -987,24 +1095,28 @@ QTreeWidgetItem *ModelObjectsWidget::getTreeItem(BaseObject *object)
 {
 	if(object)
 	{
-		QTreeWidgetItemIterator itr(objectstree_tw);
-		BaseObject *aux_obj=nullptr;
-		QTreeWidgetItem *item=nullptr;
+		map<BaseObject *, QTreeWidgetItem *>::iterator itr=obj_tree_items.find(object);
 
-		while(*itr)
+		/* If the object has no item yet it could be a child of a schema or table which item
+		was not populated so the parent's item is retrieved and populated */
+		if(itr==obj_tree_items.end())
 		{
-			aux_obj=reinterpret_cast<BaseObject *>((*itr)->data(0,Qt::UserRole).value<void *>());
+			TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+			QTreeWidgetItem *parent_item=nullptr;
 
-			if(aux_obj==object)
-			{
-				item=*itr;
-				break;
-			}
+			if(tab_obj)
+				parent_item=getTreeItem(tab_obj->getParentTable());
+			else
+				parent_item=getTreeItem(object->getSchema());
 
-			++itr;
+			if(!isItemPopulatedOnDemand(parent_item))
+				return(nullptr);
+
+			populateItem(parent_item);
+			itr=obj_tree_items.find(object);
 		}
 
-		return(item);
+		return(itr!=obj_tree_items.end() ? itr->second : nullptr);
 	}
 	else
 		return(nullptr);
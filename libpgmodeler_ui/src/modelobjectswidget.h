@@ -47,7 +47,11 @@ class ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget {
 		/*! \brief Allow the object creation in simplified mode by using the "New [object type]" popup menu.
 		This flag is ignored if the model object widget is used in the complete mode since the main purpose
 		of the widget is to allow the object management */
-		enable_obj_creation;
+		enable_obj_creation,
+
+		/*! \brief Indicates that the object list must be updated the next time it is shown. Since the list
+		view holds every single object of the model it's updated only when it's the current view */
+		list_outdated;
 
 		//! \brief Stores the reference to the object currently selected on the tree/list
 		BaseObject *selected_object;
@@ -65,15 +69,35 @@ class ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget {
 		//! \brief Stores which object types are visible on the view
 		map<ObjectType, bool> visible_objs_map;
 
+		/*! \brief Stores the tree items created for each object. This index avoids walking through
+		the whole tree every time an object's item must be retrieved */
+		map<BaseObject *, QTreeWidgetItem *> obj_tree_items;
+
 		//! \brief Updates only a schema tree starting from the 'root' item
 		void updateSchemaTree(QTreeWidgetItem *root);
 
+		//! \brief Creates the object groups (tables, views, functions, etc) of the schema represented by the 'root' item
+		void updateSchemaItem(QTreeWidgetItem *root, BaseObject *schema);
+
 		//! \brief Updates only a table tree starting from the 'root' item
 		void updateTableTree(QTreeWidgetItem *root, BaseObject *schema);
 
 		//! \brief Updates only a view tree starting from the 'root' item
 		void updateViewTree(QTreeWidgetItem *root, BaseObject *schema);
 
+		//! \brief Creates the child object groups (columns, constraints, rules, etc) of the table or view represented by the 'root' item
+		void updateTableItem(QTreeWidgetItem *root, BaseTable *table);
+
+		/*! \brief Marks the item as having its children created only when it is expanded for the first time.
+		This way huge models don't have all their objects converted into tree items at once */
+		void setItemPopulatedOnDemand(QTreeWidgetItem *item);
+
+		//! \brief Returns if the item's children weren't created yet
+		bool isItemPopulatedOnDemand(QTreeWidgetItem *item);
+
+		//! \brief Creates all the children that weren't created yet so the entire tree can be traversed (e.g. when filtering)
+		void populateAllItems(void);
+
 		//! \brief Updates only the permission tree related to the specified object
 		void updatePermissionTree(QTreeWidgetItem *root, BaseObject *object);
 
@@ -131,7 +155,11 @@ class ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget {
 		void showObjectMenu(void);
 		void editObject(void);
 		void collapseAll(void);
+		void expandAll(void);
 		void filterObjects(void);
+
+		//! \brief Creates the children of the item (if they weren't created yet)
+		void populateItem(QTreeWidgetItem *item);
 		void selectCreatedObject(BaseObject *obj);
 
 	signals:
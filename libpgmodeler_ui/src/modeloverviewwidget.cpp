@@ -41,10 +41,6 @@ void ModelOverviewWidget::show(ModelWidget *model)
 
 	if(this->model)
 	{
-		connect(this->model, SIGNAL(s_objectCreated(void)), this, SLOT(updateOverview(void)));
-		connect(this->model, SIGNAL(s_objectRemoved(void)), this, SLOT(updateOverview(void)));
-		connect(this->model, SIGNAL(s_objectsMoved(void)), this, SLOT(updateOverview(void)));
-		connect(this->model, SIGNAL(s_objectModified(void)), this, SLOT(updateOverview(void)));
 		connect(this->model, SIGNAL(s_zoomModified(double)), this, SLOT(updateZoomFactor(double)));
 
 		connect(this->model, SIGNAL(s_modelResized(void)), this, SLOT(resizeOverview(void)));
@@ -54,7 +50,9 @@ void ModelOverviewWidget::show(ModelWidget *model)
 		connect(this->model->viewport->horizontalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(resizeWindowFrame(void)));
 		connect(this->model->viewport->verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(resizeWindowFrame(void)));
 
-		connect(this->model->scene, SIGNAL(selectionChanged(void)), this, SLOT(updateOverview(void)));
+		/* Any modification on the objects (creation, removal, movement, selection, etc) is reflected in the areas notified by the objects.
+		The QGraphicsScene::changed() signal isn't used since connecting to it disables the direct updates of the items in all the views */
+		connect(this->model->scene, SIGNAL(s_objectsAreasChanged(QList<QRectF>)), this, SLOT(updateOverview(QList<QRectF>)));
 		connect(this->model->scene, SIGNAL(sceneRectChanged(QRectF)),this, SLOT(resizeOverview(void)));
 		connect(this->model->scene, SIGNAL(sceneRectChanged(QRectF)),this, SLOT(updateOverview(void)));
 
@@ -112,32 +110,194 @@ void ModelOverviewWidget::updateOverview(bool force_update)
 {
 	if(this->model && (this->isVisible() || force_update))
 	{
-		QPixmap pix;
+		//The overview is drawn directly in its final size instead of rendering the whole scene and scaling it down
+		overview_pix=QPixmap(curr_size.toSize());
 
-		//Creates a pixmap with the size of the scene
-		pix=QPixmap(pixmap_size);
-
-		//Draw the scene onto the pixmap
-		QPainter p(&pix);
-
-		if(!p.isActive())
+		if(!overview_pix.isNull())
 		{
-			label->setPixmap(QPixmap());
-			label->setText(trUtf8("Failed to generate the overview image.\nThe requested size %1 x %2 was too big and there was not enough memory to allocate!")
-										 .arg(pixmap_size.width()).arg(pixmap_size.height()));
-			frame->setEnabled(false);
+			QPainter p(&overview_pix);
+			drawOverview(&p, scene_rect);
 		}
-		else
+
+		label->setPixmap(overview_pix);
+		label->resize(curr_size.toSize());
+	}
+}
+
+void ModelOverviewWidget::updateOverview(const QList<QRectF> &areas)
+{
+	if(!this->model || !this->isVisible() || overview_pix.isNull())
+		return;
+
+	QRectF area;
+	QPainter p(&overview_pix);
+
+	//The areas are expanded in one pixel of the overview to avoid leaving traces of the previous drawing
+	double margin=1/curr_resize_factor;
+
+	/* Each area is redrawn separately since the overlapping ones are already merged by the scene.
+	Uniting distant areas (e.g. objects at opposite corners) would redraw almost the whole overview */
+	for(auto &rect : areas)
+	{
+		area=rect.adjusted(-margin, -margin, margin, margin).intersected(scene_rect);
+
+		if(area.isValid())
+			drawOverview(&p, area);
+	}
+
+	p.end();
+	label->setPixmap(overview_pix);
+}
+
+void ModelOverviewWidget::drawOverview(QPainter *painter, const QRectF &area)
+{
+	ObjectType types[]={ OBJ_SCHEMA, BASE_RELATIONSHIP, OBJ_RELATIONSHIP, OBJ_TEXTBOX, OBJ_VIEW, OBJ_TABLE };
+	BaseObjectView *obj_view=nullptr;
+	BaseObject *object=nullptr;
+	map<ObjectType, vector<BaseObjectView *>> views;
+	set<BaseObjectView *> found_views;
+	BaseRelationship *rel=nullptr;
+	BaseTable *table=nullptr;
+	Tag *tag=nullptr;
+	QString body_attrib, title_attrib;
+	QColor color, aux_color;
+	QPolygonF line;
+	QRectF rect;
+	QPen pen;
+	double title_h=QFontMetricsF(BaseObjectView::getFontStyle(ParsersAttributes::TABLE_NAME).font()).height() +
+								 (2 * BaseObjectView::VERT_SPACING);
+
+	auto getViewCenter=[](BaseObject *object){
+		BaseObjectView *view=dynamic_cast<BaseObjectView *>(dynamic_cast<BaseGraphicObject *>(object)->getReceiverObject());
+		return(view ? view->sceneBoundingRect().center() : QPointF());
+	};
+
+	painter->save();
+	painter->scale(curr_resize_factor, curr_resize_factor);
+	painter->translate(-scene_rect.topLeft());
+	painter->setClipRect(area);
+	painter->fillRect(area, Qt::white);
+
+	/* Only the objects that intersect the area are retrieved using the scene's index. The top level views
+	are grouped by type so schemas are drawn below relationships, textboxes, views and tables. The children
+	are resolved to their top level views since relationships' lines lie outside their views bounding rects */
+	for(auto &item : model->scene->items(area, Qt::IntersectsItemBoundingRect, Qt::AscendingOrder))
+	{
+		obj_view=dynamic_cast<BaseObjectView *>(item->topLevelItem());
+
+		if(!obj_view || !obj_view->isVisible() || !obj_view->getSourceObject() || found_views.count(obj_view))
+			continue;
+
+		found_views.insert(obj_view);
+		views[obj_view->getSourceObject()->getObjectType()].push_back(obj_view);
+	}
+
+	/* Instead of rendering the scene items (which would paint every single column and text at a
+	very small scale) each object is drawn as a simple box or line using the configured colors */
+	for(auto &type : types)
+	{
+		for(auto &view : views[type])
 		{
-			frame->setEnabled(true);
-			this->model->scene->render(&p, pix.rect(), scene_rect.toRect());
+			obj_view=view;
+			object=obj_view->getSourceObject();
+			rect=obj_view->sceneBoundingRect();
 
-			//Resizes the pixmap to the previous configured QSize
-			label->setPixmap(pix.scaled(curr_size.toSize(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
-		}
+			if(type==OBJ_SCHEMA)
+			{
+				color=dynamic_cast<Schema *>(object)->getFillColor();
+				color.setAlpha(BaseObjectView::OBJ_ALPHA_CHANNEL * 0.80);
+				pen=QPen(QColor(color.red()/3, color.green()/3, color.blue()/3, 80));
+				painter->setBrush(color);
+			}
+			else if(type==BASE_RELATIONSHIP || type==OBJ_RELATIONSHIP)
+			{
+				rel=dynamic_cast<BaseRelationship *>(object);
+				color=rel->getCustomColor();
 
-		label->resize(curr_size.toSize());
+				if(color==Qt::transparent)
+					color=BaseObjectView::getBorderStyle(ParsersAttributes::RELATIONSHIP).color();
+
+				line.clear();
+				line.append(getViewCenter(rel->getTable(BaseRelationship::SRC_TABLE)));
+
+				for(auto &pnt : rel->getPoints())
+					line.append(pnt);
+
+				line.append(getViewCenter(rel->getTable(BaseRelationship::DST_TABLE)));
+
+				pen=QPen(color);
+				pen.setCosmetic(true);
+				painter->setPen(pen);
+				painter->drawPolyline(line);
+			}
+			else if(type==OBJ_TEXTBOX)
+			{
+				BaseObjectView::getFillStyle(BaseObject::getSchemaName(OBJ_TEXTBOX), color, aux_color);
+				pen=BaseObjectView::getBorderStyle(BaseObject::getSchemaName(OBJ_TEXTBOX));
+				painter->setBrush(color);
+			}
+			else
+			{
+				table=dynamic_cast<BaseTable *>(object);
+				tag=table->getTag();
+
+				if(type==OBJ_VIEW && !tag)
+				{
+					body_attrib=ParsersAttributes::VIEW_BODY;
+					title_attrib=ParsersAttributes::VIEW_TITLE;
+				}
+				else
+				{
+					body_attrib=ParsersAttributes::TABLE_BODY;
+					title_attrib=ParsersAttributes::TABLE_TITLE;
+				}
+
+				//Drawing the table's title band
+				if(tag)
+				{
+					color=tag->getElementColor(title_attrib, Tag::FILL_COLOR1);
+					pen=QPen(tag->getElementColor(title_attrib, Tag::BORDER_COLOR));
+				}
+				else
+				{
+					BaseObjectView::getFillStyle(title_attrib, color, aux_color);
+					pen=BaseObjectView::getBorderStyle(title_attrib);
+				}
+
+				pen.setCosmetic(true);
+				painter->setPen(pen);
+				painter->setBrush(color);
+				painter->drawRect(QRectF(rect.topLeft(), QSizeF(rect.width(), qMin(title_h, rect.height()))));
+
+				//Configuring the body which is drawn below
+				rect.setTop(rect.top() + qMin(title_h, rect.height()));
+
+				if(tag)
+					color=tag->getElementColor(body_attrib, Tag::FILL_COLOR1);
+				else
+					BaseObjectView::getFillStyle(body_attrib, color, aux_color);
+
+				painter->setBrush(color);
+			}
+
+			if(type!=BASE_RELATIONSHIP && type!=OBJ_RELATIONSHIP)
+			{
+				pen.setCosmetic(true);
+				painter->setPen(pen);
+				painter->drawRect(rect);
+			}
+
+			//Highlighting the selected objects
+			if(obj_view->isSelected())
+			{
+				BaseObjectView::getFillStyle(ParsersAttributes::OBJ_SELECTION, color, aux_color);
+				color.setAlpha(BaseObjectView::OBJ_ALPHA_CHANNEL);
+				painter->fillRect(obj_view->sceneBoundingRect(), color);
+			}
+		}
 	}
+
+	painter->restore();
 }
 
 void ModelOverviewWidget::resizeWindowFrame(void)
@@ -182,26 +342,16 @@ void ModelOverviewWidget::resizeOverview(void)
 
 			//Reduce the resize factor and recalculates the new size
 			if(max_val >= 16384)
-			{
 				curr_resize_factor=screen_rect.width()/static_cast<double>(max_val);
-				pixmap_size.setWidth(scene_rect.size().width() * (curr_resize_factor * 10));
-				pixmap_size.setHeight(scene_rect.size().height() * (curr_resize_factor * 10));
-			}
 			else
-			{
 				curr_resize_factor=RESIZE_FACTOR/2;
-				pixmap_size=scene_rect.size().toSize();
-			}
 
 			curr_size=scene_rect.size();
 			curr_size.setWidth(curr_size.width() * curr_resize_factor);
 			curr_size.setHeight(curr_size.height() * curr_resize_factor);
 		}
 		else
-		{
 			curr_resize_factor=RESIZE_FACTOR;
-			pixmap_size=scene_rect.size().toSize();
-		}
 
 		this->resize(curr_size.toSize());
 		this->setMaximumSize(curr_size.toSize());
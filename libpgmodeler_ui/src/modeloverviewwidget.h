@@ -49,7 +49,9 @@ class ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidget {
 		//! \brief Current scene rectangle
 		QRectF scene_rect;
 
-		QSize pixmap_size;
+		/*! \brief Cached overview image (in the overview's resolution). Only the areas changed
+		on the scene are redrawn on it (see updateOverview(QList<QRectF>)) */
+		QPixmap overview_pix;
 
 		//! \brief Resize factor applied to overview widgets (default: 20% of the scene original size)
 		static constexpr double RESIZE_FACTOR=0.20f;
@@ -66,6 +68,10 @@ class ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidget {
 		is used to force the update even if the overview widget is not visible */
 		void updateOverview(bool force_update);
 
+		/*! \brief Draws onto the painter a simplified version of the objects (boxes and lines without texts)
+		that intersects the provided area (in scene coordinates) using the current resize factor */
+		void drawOverview(QPainter *painter, const QRectF &area);
+
 	public:
 		ModelOverviewWidget(QWidget *parent = 0);
 
@@ -85,6 +91,10 @@ class ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidget {
 		//! \brief Shows the overview specifying the model to be drawn
 		void show(ModelWidget *model);
 
+	private slots:
+		//! \brief Redraws only the provided areas of the scene (in scene coordinates) on the cached overview
+		void updateOverview(const QList<QRectF> &areas);
+
 	signals:
 		//! \brief Signal emitted whenever the overview window change the visibility
 		void s_overviewVisible(bool);
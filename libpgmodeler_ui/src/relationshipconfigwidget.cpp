@@ -53,6 +53,9 @@ RelationshipConfigWidget::RelationshipConfigWidget(QWidget * parent) : BaseConfi
 	tab_edges_ht=new HintTextWidget(tab_edges_hint, this);
 	tab_edges_ht->setText(tab_edges_rb->statusTip());
 
+	routed_lines_ht=new HintTextWidget(routed_lines_hint, this);
+	routed_lines_ht->setText(routed_lines_rb->statusTip());
+
 	crows_foot_ht=new HintTextWidget(crows_foot_hint, this);
 	crows_foot_ht->setText(crows_foot_rb->statusTip());
 
@@ -71,6 +74,7 @@ RelationshipConfigWidget::RelationshipConfigWidget(QWidget * parent) : BaseConfi
 	connect(fk_to_pk_rb, SIGNAL(toggled(bool)), this, SLOT(enableConnModePreview(void)));
 	connect(center_pnts_rb, SIGNAL(toggled(bool)), this, SLOT(enableConnModePreview(void)));
 	connect(tab_edges_rb, SIGNAL(toggled(bool)), this, SLOT(enableConnModePreview(void)));
+	connect(routed_lines_rb, SIGNAL(toggled(bool)), this, SLOT(enableConnModePreview(void)));
 
 	connect(deferrable_chk, SIGNAL(toggled(bool)), deferral_lbl, SLOT(setEnabled(bool)));
 	connect(deferrable_chk, SIGNAL(toggled(bool)), deferral_cmb, SLOT(setEnabled(bool)));
@@ -98,6 +102,7 @@ void RelationshipConfigWidget::loadConfiguration(void)
 		fk_to_pk_rb->setChecked(config_params[ParsersAttributes::CONNECTION][ParsersAttributes::MODE]==ParsersAttributes::CONNECT_FK_TO_PK);
 		center_pnts_rb->setChecked(config_params[ParsersAttributes::CONNECTION][ParsersAttributes::MODE]==ParsersAttributes::CONNECT_CENTER_PNTS);
 		tab_edges_rb->setChecked(config_params[ParsersAttributes::CONNECTION][ParsersAttributes::MODE]==ParsersAttributes::CONNECT_TABLE_EDGES);
+		routed_lines_rb->setChecked(config_params[ParsersAttributes::CONNECTION][ParsersAttributes::MODE]==ParsersAttributes::CONNECT_ROUTED_LINES);
 		crows_foot_rb->setChecked(config_params[ParsersAttributes::CONNECTION][ParsersAttributes::MODE]==ParsersAttributes::CROWS_FOOT);
 
 		deferrable_chk->setChecked(config_params[ParsersAttributes::FOREIGN_KEYS][ParsersAttributes::DEFERRABLE]==ParsersAttributes::_TRUE_);
@@ -146,6 +151,8 @@ void RelationshipConfigWidget::saveConfiguration(void)
 			config_params[ParsersAttributes::CONNECTION][ParsersAttributes::MODE]=ParsersAttributes::CONNECT_FK_TO_PK;
 		else if(tab_edges_rb->isChecked())
 			config_params[ParsersAttributes::CONNECTION][ParsersAttributes::MODE]=ParsersAttributes::CONNECT_TABLE_EDGES;
+		else if(routed_lines_rb->isChecked())
+			config_params[ParsersAttributes::CONNECTION][ParsersAttributes::MODE]=ParsersAttributes::CONNECT_ROUTED_LINES;
 		else
 			config_params[ParsersAttributes::CONNECTION][ParsersAttributes::MODE]=ParsersAttributes::CONNECT_CENTER_PNTS;
 
@@ -182,6 +189,8 @@ void RelationshipConfigWidget::applyConfiguration(void)
 			RelationshipView::setLineConnectionMode(RelationshipView::CONNECT_FK_TO_PK);
 		else if(tab_edges_rb->isChecked())
 			RelationshipView::setLineConnectionMode(RelationshipView::CONNECT_TABLE_EGDES);
+		else if(routed_lines_rb->isChecked())
+			RelationshipView::setLineConnectionMode(RelationshipView::CONNECT_ROUTED_LINES);
 		else
 			RelationshipView::setLineConnectionMode(RelationshipView::CONNECT_CENTER_PNTS);
 	}
@@ -265,7 +274,8 @@ void RelationshipConfigWidget::enableConnModePreview(void)
 {
 	crows_foot_lbl->setEnabled(crows_foot_rb->isChecked());
 	conn_cnt_pnts_lbl->setEnabled(center_pnts_rb->isChecked());
-	conn_tab_edges_lbl->setEnabled(tab_edges_rb->isChecked());
+	//Routed lines are attached to the tables' edges so they share the same preview
+	conn_tab_edges_lbl->setEnabled(tab_edges_rb->isChecked() || routed_lines_rb->isChecked());
 	conn_fk_pk_lbl->setEnabled(fk_to_pk_rb->isChecked());
 	setConfigurationChanged(true);
 }
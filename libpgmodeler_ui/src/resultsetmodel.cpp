@@ -0,0 +1,167 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "resultsetmodel.h"
+#include "sqlexecutionwidget.h"
+
+ResultSetModel::ResultSetModel(QObject *parent) : QAbstractTableModel(parent)
+{
+	row_count=pending_rows=0;
+}
+
+void ResultSetModel::setResultSet(Catalog &catalog, ResultSet &res)
+{
+	try
+	{
+		beginResetModel();
+
+		values.clear();
+		value_ends.clear();
+		binary_cols.clear();
+		row_count=pending_rows=0;
+
+		col_names=res.getColumnNames();
+		col_types=SQLExecutionWidget::getColumnTypeNames(catalog, res);
+
+		for(int col=0; col < col_names.size(); col++)
+			binary_cols.push_back(res.isColumnBinaryFormat(col));
+
+		appendTuples(res);
+		row_count=pending_rows;
+		pending_rows=0;
+
+		endResetModel();
+	}
+	catch(Exception &e)
+	{
+		endResetModel();
+		clear();
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void ResultSetModel::appendTuples(ResultSet &res)
+{
+	int col_cnt=col_names.size();
+
+	if(res.getColumnCount()!=col_cnt)
+		throw Exception(ERR_REF_TUPLE_COL_INV_INDEX ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(!res.accessTuple(ResultSet::FIRST_TUPLE))
+		return;
+
+	value_ends.reserve(value_ends.size() + (res.getTupleCount() * col_cnt));
+
+	do
+	{
+		for(int col=0; col < col_cnt; col++)
+		{
+			//Binary values aren't displayed so they don't need to be stored
+			if(!binary_cols[col])
+				values.append(res.getColumnData(col));
+
+			value_ends.push_back(values.size());
+		}
+
+		pending_rows++;
+	}
+	while(res.accessTuple(ResultSet::NEXT_TUPLE));
+}
+
+void ResultSetModel::flushRows(void)
+{
+	if(pending_rows==0)
+		return;
+
+	beginInsertRows(QModelIndex(), row_count, row_count + pending_rows - 1);
+	row_count+=pending_rows;
+	pending_rows=0;
+	endInsertRows();
+}
+
+void ResultSetModel::clear(void)
+{
+	beginResetModel();
+	values.clear();
+	value_ends.clear();
+	col_names.clear();
+	col_types.clear();
+	binary_cols.clear();
+	row_count=pending_rows=0;
+	endResetModel();
+}
+
+int ResultSetModel::rowCount(const QModelIndex &) const
+{
+	return(row_count);
+}
+
+int ResultSetModel::columnCount(const QModelIndex &) const
+{
+	return(col_names.size());
+}
+
+QVariant ResultSetModel::data(const QModelIndex &index, int role) const
+{
+	if(!index.isValid() || index.row() >= row_count ||
+		 (role!=Qt::DisplayRole && role!=Qt::EditRole))
+		return(QVariant());
+
+	if(binary_cols[index.column()])
+		return(trUtf8("[binary data]"));
+
+	int idx=(index.row() * col_names.size()) + index.column();
+	int start=(idx==0 ? 0 : value_ends[idx - 1]);
+
+	return(QString::fromUtf8(values.constData() + start, value_ends[idx] - start));
+}
+
+QVariant ResultSetModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+	if(orientation==Qt::Vertical)
+	{
+		if(role==Qt::DisplayRole)
+			return(QString::number(section + 1));
+	}
+	else if(section >= 0 && section < col_names.size())
+	{
+		if(role==Qt::DisplayRole)
+			return(col_names.at(section));
+		else if(role==Qt::ToolTipRole)
+			return(col_names.at(section) + QString(" [%1]").arg(col_types.at(section)));
+		else if(role==Qt::UserRole)
+			return(col_types.at(section));
+		else if(role==Qt::TextAlignmentRole)
+			return(static_cast<int>(Qt::AlignLeft | Qt::AlignVCenter));
+	}
+
+	return(QVariant());
+}
+
+Qt::ItemFlags ResultSetModel::flags(const QModelIndex &index) const
+{
+	if(!index.isValid())
+		return(Qt::NoItemFlags);
+
+	//Binary columns can't be opened in the (read-only) editor
+	if(binary_cols[index.column()])
+		return(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
+
+	//Other values can be opened in the read-only editor so long texts can be inspected
+	return(Qt::ItemIsSelectable | Qt::ItemIsEnabled | Qt::ItemIsEditable);
+}
@@ -0,0 +1,78 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class ResultSetModel
+\brief Implements a read-only table model that holds the tuples of one or more result sets of the same command.
+The values are copied once from the results (without any conversion) into a single buffer and are converted
+to strings only when the view requests them, so no per-cell object is allocated.
+*/
+
+#ifndef RESULT_SET_MODEL_H
+#define RESULT_SET_MODEL_H
+
+#include <QAbstractTableModel>
+#include "catalog.h"
+
+class ResultSetModel: public QAbstractTableModel {
+	private:
+		Q_OBJECT
+
+		//! \brief Amount of rows exposed to the views and the amount of rows appended but not flushed yet
+		int row_count, pending_rows;
+
+		//! \brief Names and data types of the columns
+		QStringList col_names, col_types;
+
+		//! \brief Indicates which columns are in binary format (those ones are not displayed)
+		vector<bool> binary_cols;
+
+		//! \brief Raw values of all tuples stored contiguously (row by row)
+		QByteArray values;
+
+		/*! \brief Stores the end position of each value in the buffer. The value of the cell (row, col) is
+		in the interval [value_ends[idx - 1], value_ends[idx]) where idx = (row * column count) + col */
+		vector<int> value_ends;
+
+	public:
+		ResultSetModel(QObject *parent = 0);
+
+		/*! \brief Clears the model and configures the columns based upon the provided result set appending its tuples.
+		The catalog is used to retrieve the data type names of the columns */
+		void setResultSet(Catalog &catalog, ResultSet &res);
+
+		/*! \brief Appends the tuples of the provided result set (which must have the same columns configured by setResultSet()).
+		The new rows are only exposed to the views when flushRows() is called, this way several results can be appended
+		(e.g. the ones retrieved in single row mode) with a single notification to the views */
+		void appendTuples(ResultSet &res);
+
+		//! \brief Exposes to the views the rows appended by appendTuples()
+		void flushRows(void);
+
+		//! \brief Removes all rows and columns
+		void clear(void);
+
+		int rowCount(const QModelIndex &parent = QModelIndex()) const;
+		int columnCount(const QModelIndex &parent = QModelIndex()) const;
+		QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+		QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+		Qt::ItemFlags flags(const QModelIndex &index) const;
+};
+
+#endif
@@ -28,10 +28,16 @@ map<QString, QString> SQLExecutionWidget::cmd_history;
 
 int SQLExecutionWidget::cmd_history_max_len = 1000;
 
+map<QString, map<unsigned, QString>> SQLExecutionWidget::type_names_cache;
+
 SQLExecutionWidget::SQLExecutionWidget(QWidget * parent) : QWidget(parent)
 {
 	setupUi(this);
 
+	sql_notifier=nullptr;
+	res_started=last_res_tuples=false;
+	last_res_rows=0;
+
 	sql_cmd_txt=PgModelerUiNS::createNumberedTextEditor(sql_cmd_wgt);
 	cmd_history_txt=PgModelerUiNS::createNumberedTextEditor(cmd_history_parent);
 	cmd_history_txt->setCustomContextMenuEnabled(false);
@@ -74,17 +80,28 @@ SQLExecutionWidget::SQLExecutionWidget(QWidget * parent) : QWidget(parent)
 	find_wgt_parent->setVisible(false);
 
 	run_sql_tb->setToolTip(run_sql_tb->toolTip() + QString(" (%1)").arg(run_sql_tb->shortcut().toString()));
+	cancel_sql_tb->setToolTip(cancel_sql_tb->toolTip() + QString(" (%1)").arg(cancel_sql_tb->shortcut().toString()));
 	export_tb->setToolTip(export_tb->toolTip() + QString(" (%1)").arg(export_tb->shortcut().toString()));
 	file_tb->setToolTip(file_tb->toolTip() + QString(" (%1)").arg(file_tb->shortcut().toString()));
 	output_tb->setToolTip(output_tb->toolTip() + QString(" (%1)").arg(output_tb->shortcut().toString()));
 	find_tb->setToolTip(find_tb->toolTip() + QString(" (%1)").arg(find_tb->shortcut().toString()));
 
-	results_tbw->setItemDelegate(new PlainTextItemDelegate(this, true));
+	results_model=new ResultSetModel(this);
+	results_tbv->setModel(results_model);
+	results_tbv->setItemDelegate(new PlainTextItemDelegate(this, true));
+	results_tbv->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
 
 	action_load=new QAction(QIcon(PgModelerUiNS::getIconPath("abrir")), trUtf8("Load"), this);
 	action_save=new QAction(QIcon(PgModelerUiNS::getIconPath("salvar")), trUtf8("Save"), this);
 	action_save_as=new QAction(QIcon(PgModelerUiNS::getIconPath("salvar_como")), trUtf8("Save as"), this);
 
+	action_export_results=export_menu.addAction(QIcon(PgModelerUiNS::getIconPath("exportdata")), trUtf8("Export results"));
+	action_export_results->setEnabled(false);
+	action_export_query=export_menu.addAction(QIcon(PgModelerUiNS::getIconPath("exportdata")), trUtf8("Export query to file"));
+	action_export_query->setToolTip(trUtf8("Runs the query and writes its rows directly to a file without loading them in the results grid"));
+	export_tb->setMenu(&export_menu);
+	export_tb->setPopupMode(QToolButton::InstantPopup);
+
 	file_menu.addAction(action_load);
 	file_menu.addAction(action_save);
 	file_menu.addAction(action_save_as);
@@ -97,15 +114,18 @@ SQLExecutionWidget::SQLExecutionWidget(QWidget * parent) : QWidget(parent)
 	connect(clear_btn, SIGNAL(clicked(void)), this, SLOT(clearAll(void)));
 	connect(sql_cmd_txt, SIGNAL(textChanged(void)), this, SLOT(enableCommandButtons(void)));
 	connect(run_sql_tb, SIGNAL(clicked(void)), this, SLOT(runSQLCommand(void)));
+	connect(cancel_sql_tb, SIGNAL(clicked(void)), this, SLOT(cancelSQLCommand(void)));
 	connect(find_tb, SIGNAL(toggled(bool)), find_wgt_parent, SLOT(setVisible(bool)));
 	connect(output_tb, SIGNAL(toggled(bool)), this, SLOT(toggleOutputPane(bool)));
 
 	//Signal handling with C++11 lambdas Slots
-	connect(results_tbw, &QTableWidget::itemPressed,
-			[&](){ SQLExecutionWidget::copySelection(results_tbw); });
+	connect(results_tbv, &QTableView::pressed,
+			[&](){ SQLExecutionWidget::copySelection(results_tbv); });
+
+	connect(action_export_results, &QAction::triggered,
+			[&](){ SQLExecutionWidget::exportResults(results_tbv); });
 
-	connect(export_tb, &QToolButton::clicked,
-			[&](){ SQLExecutionWidget::exportResults(results_tbw); });
+	connect(action_export_query, SIGNAL(triggered(bool)), this, SLOT(exportQueryToFile()));
 
 	connect(close_file_tb, &QToolButton::clicked,
 	[&](){
@@ -168,9 +188,14 @@ void SQLExecutionWidget::setConnection(Connection conn)
 
 void SQLExecutionWidget::enableCommandButtons(void)
 {
-	run_sql_tb->setEnabled(!sql_cmd_txt->toPlainText().isEmpty());
+	//The run button is kept disabled while a command is in execution
+	run_sql_tb->setEnabled(!sql_notifier && !sql_cmd_txt->toPlainText().isEmpty());
 	find_tb->setEnabled(!sql_cmd_txt->toPlainText().isEmpty());
-	clear_btn->setEnabled(run_sql_tb->isEnabled());
+	clear_btn->setEnabled(!sql_notifier && !sql_cmd_txt->toPlainText().isEmpty());
+
+	//The query can be exported to a file even if its results weren't retrieved
+	action_export_query->setEnabled(!sql_notifier && !sql_cmd_txt->toPlainText().isEmpty());
+	export_tb->setEnabled(action_export_results->isEnabled() || action_export_query->isEnabled());
 }
 
 void SQLExecutionWidget::fillResultsTable(ResultSet &res)
@@ -181,9 +206,10 @@ void SQLExecutionWidget::fillResultsTable(ResultSet &res)
 		Connection aux_conn;
 
 		aux_conn.setConnectionParams(sql_cmd_conn.getConnectionParams());
-		export_tb->setEnabled(res.getTupleCount() > 0);
+		action_export_results->setEnabled(res.getTupleCount() > 0);
+		enableCommandButtons();
 		catalog.setConnection(aux_conn);
-		fillResultsTable(catalog, res, results_tbw);
+		results_model->setResultSet(catalog, res);
 	}
 	catch(Exception &e)
 	{
@@ -208,6 +234,7 @@ void SQLExecutionWidget::resizeEvent(QResizeEvent *event)
 	{
 		file_tb->setToolButtonStyle(style);
 		run_sql_tb->setToolButtonStyle(style);
+		cancel_sql_tb->setToolButtonStyle(style);
 		clear_btn->setToolButtonStyle(style);
 		find_tb->setToolButtonStyle(style);
 		snippets_tb->setToolButtonStyle(style);
@@ -223,52 +250,128 @@ void SQLExecutionWidget::fillResultsTable(Catalog &catalog, ResultSet &res, QTab
 
 	try
 	{
-		int col=0, row=0, col_cnt=res.getColumnCount();
+		int col=0, col_cnt=res.getColumnCount();
 		QTableWidgetItem *item=nullptr;
-		vector<unsigned> type_ids;
-		vector<unsigned>::iterator end;
-		vector<attribs_map> types;
-		map<unsigned, QString> type_names;
-		unsigned orig_filter=catalog.getFilter();
+		QStringList type_names;
 
 		results_tbw->setRowCount(0);
 		results_tbw->setColumnCount(col_cnt);
 		results_tbw->verticalHeader()->setVisible(true);
 		results_tbw->blockSignals(true);
 
-		//Configuring the grid columns with the names of retrived table columns
+		type_names=getColumnTypeNames(catalog, res);
+
+		/* Configuring the grid columns with the names of retrived table columns
+		and assinging the type names as tooltip on header items */
 		for(col=0; col < col_cnt; col++)
 		{
-			type_ids.push_back(res.getColumnTypeId(col));
 			item=new QTableWidgetItem(res.getColumnName(col));
 			item->setTextAlignment(Qt::AlignLeft | Qt::AlignVCenter);
+			item->setToolTip(res.getColumnName(col) + QString(" [%1]").arg(type_names[col]));
+			item->setData(Qt::UserRole, type_names[col]);
 			results_tbw->setHorizontalHeaderItem(col, item);
 		}
 
-		//Retrieving the data type names for each column
-		catalog.setFilter(Catalog::LIST_ALL_OBJS);
-		std::sort(type_ids.begin(), type_ids.end());
-		end=std::unique(type_ids.begin(), type_ids.end());
-		type_ids.erase(end, type_ids.end());
-
-		types=catalog.getObjectsAttributes(OBJ_TYPE, QString(), QString(), type_ids);
+		appendResultsRows(res, results_tbw, store_data);
 
-		for(auto &tp : types)
-			type_names[tp[ParsersAttributes::OID].toUInt()]=tp[ParsersAttributes::NAME];
+		results_tbw->blockSignals(false);
+		results_tbw->resizeColumnsToContents();
+		results_tbw->resizeRowsToContents();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
 
-		catalog.setFilter(orig_filter);
+QStringList SQLExecutionWidget::getColumnTypeNames(Catalog &catalog, ResultSet &res)
+{
+	try
+	{
+		int col=0, col_cnt=res.getColumnCount();
+		vector<unsigned> type_ids;
+		vector<unsigned>::iterator end;
+		vector<attribs_map> types;
+		map<unsigned, QString> &type_names=type_names_cache[catalog.getConnectionId()];
+		unsigned orig_filter=catalog.getFilter();
+		QStringList col_types;
 
-		//Assinging the type names as tooltip on header items
+		//Only the types not cached yet are queried on the catalog
 		for(col=0; col < col_cnt; col++)
 		{
-			item=results_tbw->horizontalHeaderItem(col);
-			item->setToolTip(res.getColumnName(col) + QString(" [%1]").arg(type_names[res.getColumnTypeId(col)]));
-			item->setData(Qt::UserRole, type_names[res.getColumnTypeId(col)]);
+			if(type_names.count(res.getColumnTypeId(col))==0)
+				type_ids.push_back(res.getColumnTypeId(col));
+		}
+
+		if(!type_ids.empty())
+		{
+			//Retrieving the data type names for each column
+			catalog.setFilter(Catalog::LIST_ALL_OBJS);
+			std::sort(type_ids.begin(), type_ids.end());
+			end=std::unique(type_ids.begin(), type_ids.end());
+			type_ids.erase(end, type_ids.end());
+
+			types=catalog.getObjectsAttributes(OBJ_TYPE, QString(), QString(), type_ids);
+
+			for(auto &tp : types)
+				type_names[tp[ParsersAttributes::OID].toUInt()]=tp[ParsersAttributes::NAME];
+
+			catalog.setFilter(orig_filter);
 		}
 
+		for(col=0; col < col_cnt; col++)
+			col_types.push_back(type_names[res.getColumnTypeId(col)]);
+
+		return(col_types);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void SQLExecutionWidget::resizeColumnsToRows(QTableView *results_tbv, int max_rows)
+{
+	if(!results_tbv || !results_tbv->model())
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	QAbstractItemModel *model=results_tbv->model();
+	int width=0, row_cnt=0;
+
+	/* The viewport may not have its final size yet (e.g. the view was just shown) so the window's height
+	is used as the maximum height in which the rows can be visible */
+	if(max_rows < 0)
+		max_rows=(qMax(results_tbv->viewport()->height(), results_tbv->window()->height()) /
+							qMax(1, results_tbv->verticalHeader()->defaultSectionSize())) + 1;
+
+	row_cnt=qMin(model->rowCount(), max_rows);
+
+	for(int col=0; col < model->columnCount(); col++)
+	{
+		width=results_tbv->horizontalHeader()->sectionSizeHint(col);
+
+		for(int row=0; row < row_cnt; row++)
+			width=qMax(width, results_tbv->sizeHintForIndex(model->index(row, col)).width());
+
+		results_tbv->setColumnWidth(col, width + (results_tbv->showGrid() ? 1 : 0));
+	}
+}
+
+void SQLExecutionWidget::appendResultsRows(ResultSet &res, QTableWidget *results_tbw, bool store_data)
+{
+	if(!results_tbw)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	try
+	{
+		int col=0, row=results_tbw->rowCount(), col_cnt=res.getColumnCount();
+		QTableWidgetItem *item=nullptr;
+		bool sig_blocked=results_tbw->signalsBlocked();
+
 		if(res.accessTuple(ResultSet::FIRST_TUPLE))
 		{
-			results_tbw->setRowCount(res.getTupleCount());
+			results_tbw->blockSignals(true);
+			results_tbw->setRowCount(row + res.getTupleCount());
 
 			do
 			{
@@ -299,11 +402,9 @@ void SQLExecutionWidget::fillResultsTable(Catalog &catalog, ResultSet &res, QTab
 				row++;
 			}
 			while(res.accessTuple(ResultSet::NEXT_TUPLE));
-		}
 
-		results_tbw->blockSignals(false);
-		results_tbw->resizeColumnsToContents();
-		results_tbw->resizeRowsToContents();
+			results_tbw->blockSignals(sig_blocked);
+		}
 	}
 	catch(Exception &e)
 	{
@@ -331,7 +432,8 @@ void SQLExecutionWidget::showError(Exception &e)
 
 	msgoutput_lst->setVisible(true);
 	results_parent->setVisible(false);
-	export_tb->setEnabled(false);
+	action_export_results->setEnabled(false);
+	enableCommandButtons();
 
 	output_tbw->setTabText(0, trUtf8("Results"));
 	output_tbw->setTabText(1, trUtf8("Messages (%1)").arg(msgoutput_lst->count()));
@@ -400,11 +502,12 @@ void SQLExecutionWidget::runSQLCommand(void)
 {
 	QString cmd=sql_cmd_txt->textCursor().selectedText();
 
+	//Avoids running a second command while the previous one is still in execution
+	if(sql_notifier)
+		return;
+
 	try
 	{
-		ResultSet res;
-		QStringList conn_notices;
-
 		output_tb->setChecked(true);
 
 		if(cmd.isEmpty())
@@ -423,20 +526,134 @@ void SQLExecutionWidget::runSQLCommand(void)
 			sql_cmd_conn.setSQLExecutionTimout(3600);
 		}
 
-		QApplication::setOverrideCursor(Qt::WaitCursor);
-		sql_cmd_conn.executeDMLCommand(cmd, res);
-		conn_notices=sql_cmd_conn.getNotices();
+		running_cmd=cmd;
+		res_started=last_res_tuples=false;
+		last_res_rows=0;
+
+		/* The command is sent in single row mode so the tuples can be displayed as soon as they arrive
+		while the user interface keeps responsive and the command can be canceled at any time */
+		sql_cmd_conn.sendCommand(cmd, true);
+
+		sql_notifier=new QSocketNotifier(sql_cmd_conn.getSocketDescriptor(), QSocketNotifier::Read, this);
+		connect(sql_notifier, SIGNAL(activated(int)), this, SLOT(retrieveResults(void)));
+
+		run_sql_tb->setEnabled(false);
+		clear_btn->setEnabled(false);
+		cancel_sql_tb->setEnabled(true);
+
+		PgModelerUiNS::createOutputListItem(msgoutput_lst,
+																				PgModelerUiNS::formatMessage(trUtf8("[%1]: Running SQL command...")
+																																		 .arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz")))),
+																				QPixmap(PgModelerUiNS::getIconPath("msgbox_info")));
+		output_tbw->setTabText(1, trUtf8("Messages (%1)").arg(msgoutput_lst->count()));
+	}
+	catch(Exception &e)
+	{
+		finishSQLCommand();
+		addToSQLHistory(cmd, 0, e.getErrorMessage());
+		sql_cmd_conn.close();
+		showError(e);
+	}
+}
+
+void SQLExecutionWidget::retrieveResults(void)
+{
+	if(!sql_notifier)
+		return;
+
+	try
+	{
+		ResultSet res;
+		QStringList conn_notices;
+		bool finished=false;
+		unsigned res_count=0;
+
+		results_tbv->setUpdatesEnabled(false);
+
+		/* Retrieving the results available without blocking the user interface. At most MAX_RESULTS_PER_ROUND
+		results are handled per call so a fast server can't keep the event loop starving */
+		while(!finished && res_count < MAX_RESULTS_PER_ROUND && sql_cmd_conn.isAsyncResultReady())
+		{
+			res_count++;
+
+			if(!sql_cmd_conn.getAsyncResult(res))
+				finished=true;
+			else if(res.isEmpty())
+			{
+				//Commands that don't return tuples only inform the amount of affected rows
+				last_res_tuples=res_started=false;
+				last_res_rows=res.getTupleCount();
+			}
+			else if(res.getTupleCount() > 0)
+			{
+				//The first row of a statement's result configures the grid columns
+				if(!res_started)
+				{
+					results_tbv->setUpdatesEnabled(true);
+					fillResultsTable(res);
+					results_tbv->setUpdatesEnabled(false);
+					res_started=last_res_tuples=true;
+
+					results_parent->setVisible(true);
+					output_tbw->setTabEnabled(0, true);
+					output_tbw->setCurrentIndex(0);
+				}
+				else
+					//The rows are only stored here, they are exposed to the grid all at once after the loop
+					results_model->appendTuples(res);
+			}
+			else
+			{
+				//An empty tuple set indicates the end of the statement's result
+				if(!res_started)
+				{
+					fillResultsTable(res);
+					last_res_tuples=true;
+					last_res_rows=0;
+				}
+				else
+				{
+					results_model->flushRows();
+					last_res_rows=results_model->rowCount();
+				}
+
+				res_started=false;
+			}
+		}
+
+		if(res_started)
+		{
+			results_model->flushRows();
+			last_res_rows=results_model->rowCount();
+			output_tbw->setTabText(0, trUtf8("Results (%1)").arg(last_res_rows));
+		}
+
+		results_tbv->setUpdatesEnabled(true);
+
+		if(!finished)
+		{
+			/* The results already read from the socket are buffered by libpq so the notifier won't be activated
+			for them again. When the limit was reached the retrieval is resumed as soon as the pending events are processed */
+			if(res_count >= MAX_RESULTS_PER_ROUND)
+				QTimer::singleShot(0, this, SLOT(retrieveResults(void)));
 
-		addToSQLHistory(cmd, res.getTupleCount());
+			return;
+		}
+
+		finishSQLCommand();
+		conn_notices=sql_cmd_conn.getNotices();
+		addToSQLHistory(running_cmd, last_res_rows);
 
-		output_tbw->setTabEnabled(0, !res.isEmpty());
-		results_parent->setVisible(!res.isEmpty());
-		export_tb->setEnabled(!res.isEmpty());
+		output_tbw->setTabEnabled(0, last_res_tuples);
+		results_parent->setVisible(last_res_tuples);
+		action_export_results->setEnabled(last_res_tuples && last_res_rows > 0);
+		enableCommandButtons();
 
-		if(!res.isEmpty())
+		if(last_res_tuples)
 		{
-			fillResultsTable(res);
-			output_tbw->setTabText(0, trUtf8("Results (%1)").arg(res.getTupleCount()));
+			//Only the rows in the viewport are used to size the columns since the result can be huge
+			resizeColumnsToRows(results_tbv);
+			output_tbw->setTabText(0, trUtf8("Results (%1)").arg(last_res_rows));
 			output_tbw->setCurrentIndex(0);
 		}
 		else
@@ -457,23 +674,55 @@ void SQLExecutionWidget::runSQLCommand(void)
 		PgModelerUiNS::createOutputListItem(msgoutput_lst,
 																				PgModelerUiNS::formatMessage(trUtf8("[%1]: SQL command successfully executed. <em>%2 <strong>%3</strong></em>")
 																																		 .arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz")))
-																																		 .arg(res.isEmpty() ? trUtf8("Rows affected") :  trUtf8("Rows retrieved"))
-																																		 .arg(res.getTupleCount())),
+																																		 .arg(!last_res_tuples ? trUtf8("Rows affected") :  trUtf8("Rows retrieved"))
+																																		 .arg(last_res_rows)),
 																				QPixmap(PgModelerUiNS::getIconPath("msgbox_info")));
 
 		output_tbw->setTabText(1, trUtf8("Messages (%1)").arg(msgoutput_lst->count()));
+	}
+	catch(Exception &e)
+	{
+		results_tbv->setUpdatesEnabled(true);
+		finishSQLCommand();
+		addToSQLHistory(running_cmd, 0, e.getErrorMessage());
+		sql_cmd_conn.close();
+		showError(e);
+	}
+}
 
-		QApplication::restoreOverrideCursor();
+void SQLExecutionWidget::cancelSQLCommand(void)
+{
+	if(!sql_notifier)
+		return;
+
+	try
+	{
+		//The cancellation error will be reported by the server as the result of the running command
+		cancel_sql_tb->setEnabled(false);
+		sql_cmd_conn.cancelCommand();
 	}
 	catch(Exception &e)
 	{
-		addToSQLHistory(cmd, 0, e.getErrorMessage());
-		QApplication::restoreOverrideCursor();
+		finishSQLCommand();
+		addToSQLHistory(running_cmd, 0, e.getErrorMessage());
 		sql_cmd_conn.close();
 		showError(e);
 	}
 }
 
+void SQLExecutionWidget::finishSQLCommand(void)
+{
+	if(sql_notifier)
+	{
+		sql_notifier->setEnabled(false);
+		sql_notifier->deleteLater();
+		sql_notifier=nullptr;
+	}
+
+	cancel_sql_tb->setEnabled(false);
+	enableCommandButtons();
+}
+
 void SQLExecutionWidget::saveCommands(void)
 {
 	bool browse_file = (sender() == action_save_as || filename_edt->text().isEmpty());
@@ -533,9 +782,9 @@ void SQLExecutionWidget::loadCommands(void)
 	}
 }
 
-void SQLExecutionWidget::exportResults(QTableWidget *results_tbw)
+void SQLExecutionWidget::exportResults(QTableView *results_tbw)
 {
-	if(!results_tbw)
+	if(!results_tbw || !results_tbw->model())
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	QFileDialog csv_file_dlg;
@@ -552,6 +801,8 @@ void SQLExecutionWidget::exportResults(QTableWidget *results_tbw)
 	if(csv_file_dlg.result()==QDialog::Accepted)
 	{
 		QFile file;
+		QAbstractItemModel *model=results_tbw->model();
+
 		file.setFileName(csv_file_dlg.selectedFiles().at(0));
 
 		if(!file.open(QFile::WriteOnly))
@@ -559,81 +810,168 @@ void SQLExecutionWidget::exportResults(QTableWidget *results_tbw)
 							.arg(csv_file_dlg.selectedFiles().at(0))
 							, ERR_FILE_DIR_NOT_ACCESSED ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		file.write(generateCSVBuffer(results_tbw, 0, 0, results_tbw->rowCount(), results_tbw->columnCount()));
+		//The rows are written straight to the file instead of being buffered first
+		writeResults(model, 0, 0, model->rowCount(), model->columnCount(), true, file);
 		file.close();
 	}
 }
 
-QByteArray SQLExecutionWidget::generateCSVBuffer(QTableWidget *results_tbw, int start_row, int start_col, int row_cnt, int col_cnt)
+void SQLExecutionWidget::exportQueryToFile(void)
 {
-	if(!results_tbw)
-		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	QString cmd=sql_cmd_txt->textCursor().selectedText();
+	QFileDialog csv_file_dlg;
 
-	QByteArray buf;
-	QStringList line;
+	if(cmd.isEmpty())
+		cmd=sql_cmd_txt->toPlainText();
+	else
+		cmd.replace(QChar::ParagraphSeparator, '\n');
 
-	//If the selection interval is valid
-	if(start_row >=0 && start_col >=0 &&
-			start_row + row_cnt <= results_tbw->rowCount() &&
-			start_col + col_cnt <= results_tbw->columnCount())
+	//The query is used as a subquery of COPY so the trailing semicolon must be removed
+	cmd=cmd.trimmed();
+	while(cmd.endsWith(QChar(';')))
 	{
-		int col=0, row=0,
-				max_col=start_col + col_cnt,
-				max_row=start_row + row_cnt;
+		cmd.chop(1);
+		cmd=cmd.trimmed();
+	}
 
-		//Creating the header of csv
-		for(col=start_col; col < max_col; col++)
-			line.append(QString("\"%1\"").arg(results_tbw->horizontalHeaderItem(col)->text()));
+	if(cmd.isEmpty())
+		return;
+
+	csv_file_dlg.setDefaultSuffix(QString("csv"));
+	csv_file_dlg.setFileMode(QFileDialog::AnyFile);
+	csv_file_dlg.setWindowTitle(trUtf8("Save CSV file"));
+	csv_file_dlg.setNameFilter(trUtf8("Comma-separated values file (*.csv);;All files (*.*)"));
+	csv_file_dlg.setModal(true);
+	csv_file_dlg.setAcceptMode(QFileDialog::AcceptSave);
+	csv_file_dlg.exec();
 
-		buf.append(line.join(';'));
-		buf.append('\n');
-		line.clear();
+	if(csv_file_dlg.result()!=QDialog::Accepted)
+		return;
 
-		//Creating the content
-		for(row=start_row; row < max_row; row++)
+	TaskProgressWidget task_prog_wgt(this);
+	Connection conn=Connection(sql_cmd_conn.getConnectionParams());
+	QFile file;
+	QByteArray data;
+	unsigned row_cnt=0;
+	bool copy_started=false;
+
+	try
+	{
+		file.setFileName(csv_file_dlg.selectedFiles().at(0));
+
+		if(!file.open(QFile::WriteOnly))
+			throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED).arg(file.fileName()),
+											ERR_FILE_DIR_NOT_ACCESSED ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		task_prog_wgt.setWindowTitle(trUtf8("Exporting query results"));
+		task_prog_wgt.show();
+
+		//A dedicated connection is used so the export doesn't interfere in the commands executed in the widget
+		conn.connect();
+		//The line break before the closing parenthesis prevents a trailing line comment in the query from commenting it out
+		conn.startCopyOut(QString("COPY (%1\n) TO STDOUT WITH (FORMAT csv, HEADER true, DELIMITER ';')").arg(cmd));
+		copy_started=true;
+
+		//Each chunk retrieved holds a single row which is written to the file as soon as it arrives
+		while(conn.getCopyData(data))
 		{
-			for(col=start_col; col < max_col; col++)
-				line.append(QString("\"%1\"").arg(results_tbw->item(row, col)->text()));
+			if(file.write(data)!=data.size())
+				throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED).arg(file.fileName()),
+												ERR_FILE_DIR_NOT_ACCESSED ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-			buf.append(line.join(';'));
-			line.clear();
-			buf.append('\n');
+			if((++row_cnt % 10000)==0)
+				task_prog_wgt.updateProgress(0, trUtf8("Writing rows to file... (%1 rows written)").arg(row_cnt), BASE_OBJECT);
 		}
+
+		copy_started=false;
+		row_cnt=conn.endCopyOut();
+
+		file.close();
+		conn.close();
+		task_prog_wgt.close();
+
+		PgModelerUiNS::createOutputListItem(msgoutput_lst,
+																				PgModelerUiNS::formatMessage(trUtf8("[%1]: Query results exported to the file <em>%2</em>. <em>Rows exported <strong>%3</strong></em>")
+																																		 .arg(QTime::currentTime().toString(QString("hh:mm:ss.zzz")))
+																																		 .arg(file.fileName()).arg(row_cnt)),
+																				QPixmap(PgModelerUiNS::getIconPath("msgbox_info")));
+
+		output_tb->setChecked(true);
+		output_tbw->setTabText(1, trUtf8("Messages (%1)").arg(msgoutput_lst->count()));
+		output_tbw->setCurrentIndex(1);
 	}
+	catch(Exception &e)
+	{
+		Messagebox msg_box;
 
-	return(buf);
+		/* The connection is closed when the error happens in the middle of the copy
+		since the remaining data would have to be consumed in order to reuse it */
+		if(copy_started)
+			conn.close();
+
+		task_prog_wgt.close();
+		file.close();
+
+		//The error isn't shown in the output pane in order to preserve the results of the last executed command
+		msg_box.show(e);
+	}
 }
 
-QByteArray SQLExecutionWidget::generateTextBuffer(QTableWidget *results_tbw, int start_row, int start_col, int row_cnt, int col_cnt)
+void SQLExecutionWidget::writeResults(QAbstractItemModel *model, int start_row, int start_col, int row_cnt, int col_cnt, bool csv_format, QIODevice &output)
 {
-	if(!results_tbw)
+	if(!model)
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	QByteArray buf;
-	QStringList line;
-
 	//If the selection interval is valid
 	if(start_row >=0 && start_col >=0 &&
-			start_row + row_cnt <= results_tbw->rowCount() &&
-			start_col + col_cnt <= results_tbw->columnCount())
+			start_row + row_cnt <= model->rowCount() &&
+			start_col + col_cnt <= model->columnCount())
 	{
 		int col=0, row=0,
 				max_col=start_col + col_cnt,
 				max_row=start_row + row_cnt;
+		QStringList line;
+		QChar separator=(csv_format ? QChar(';') : QChar('\t'));
+
+		//Creating the header of csv
+		if(csv_format)
+		{
+			for(col=start_col; col < max_col; col++)
+				line.append(QString("\"%1\"").arg(model->headerData(col, Qt::Horizontal).toString()));
+
+			output.write(line.join(separator).toUtf8());
+			output.write("\n");
+			line.clear();
+		}
 
 		//Creating the content
 		for(row=start_row; row < max_row; row++)
 		{
 			for(col=start_col; col < max_col; col++)
 			{
-				line.push_back(results_tbw->item(row, col)->text());
+				if(csv_format)
+					line.append(QString("\"%1\"").arg(model->index(row, col).data().toString()));
+				else
+					line.append(model->index(row, col).data().toString());
 			}
 
-			buf.append(line.join('\t'));
+			output.write(line.join(separator).toUtf8());
+			output.write("\n");
 			line.clear();
-			buf.append('\n');
 		}
 	}
+}
+
+QByteArray SQLExecutionWidget::generateCSVBuffer(QTableView *results_tbw, int start_row, int start_col, int row_cnt, int col_cnt)
+{
+	if(!results_tbw)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	QByteArray buf;
+	QBuffer output(&buf);
+
+	output.open(QBuffer::WriteOnly);
+	writeResults(results_tbw->model(), start_row, start_col, row_cnt, col_cnt, true, output);
 
 	return(buf);
 }
@@ -653,19 +991,35 @@ int SQLExecutionWidget::clearAll(void)
 		sql_cmd_txt->setPlainText(QString());
 		msgoutput_lst->clear();
 		msgoutput_lst->setVisible(true);
+		results_model->clear();
 		results_parent->setVisible(false);
-		export_tb->setEnabled(false);
+		action_export_results->setEnabled(false);
+		enableCommandButtons();
 	}
 
 	return(res);
 }
 
-void SQLExecutionWidget::copySelection(QTableWidget *results_tbw, bool use_popup, bool csv_is_default)
+QByteArray SQLExecutionWidget::generateTextBuffer(QTableView *results_tbw, int start_row, int start_col, int row_cnt, int col_cnt)
 {
 	if(!results_tbw)
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	QList<QTableWidgetSelectionRange> sel_ranges=results_tbw->selectedRanges();
+	QByteArray buf;
+	QBuffer output(&buf);
+
+	output.open(QBuffer::WriteOnly);
+	writeResults(results_tbw->model(), start_row, start_col, row_cnt, col_cnt, false, output);
+
+	return(buf);
+}
+
+void SQLExecutionWidget::copySelection(QTableView *results_tbw, bool use_popup, bool csv_is_default)
+{
+	if(!results_tbw || !results_tbw->selectionModel())
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	QItemSelection sel_ranges=results_tbw->selectionModel()->selection();
 
 	if(sel_ranges.count()==1 && (!use_popup || (use_popup && QApplication::mouseButtons()==Qt::RightButton)))
 	{
@@ -683,15 +1037,15 @@ void SQLExecutionWidget::copySelection(QTableWidget *results_tbw, bool use_popup
 
 		if(!use_popup || act)
 		{
-			QTableWidgetSelectionRange selection=sel_ranges.at(0);
+			QItemSelectionRange selection=sel_ranges.at(0);
 			QByteArray buf;
 
 			if((use_popup && act == act_csv) || (!use_popup && csv_is_default))
 			{
 				//Generates the csv buffer and assigns it to application's clipboard
 				buf=generateCSVBuffer(results_tbw,
-															selection.topRow(), selection.leftColumn(),
-															selection.rowCount(), selection.columnCount());
+															selection.top(), selection.left(),
+															selection.height(), selection.width());
 
 				/* Making DataManipulationForm instances know that the clipboard has csv buffer
 				 * in order to paste the contents properly */
@@ -700,8 +1054,8 @@ void SQLExecutionWidget::copySelection(QTableWidget *results_tbw, bool use_popup
 			else if((use_popup && act == act_txt) || (!use_popup && !csv_is_default))
 			{
 				buf=generateTextBuffer(results_tbw,
-															 selection.topRow(), selection.leftColumn(),
-															 selection.rowCount(), selection.columnCount());
+															 selection.top(), selection.left(),
+															 selection.height(), selection.width());
 			}
 
 			qApp->clipboard()->setText(buf);
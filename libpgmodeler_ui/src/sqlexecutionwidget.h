@@ -33,6 +33,10 @@
 #include "codecompletionwidget.h"
 #include "numberedtexteditor.h"
 #include "findreplacewidget.h"
+#include "resultsetmodel.h"
+#include <QSocketNotifier>
+#include <QBuffer>
+#include <QTimer>
 
 class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 	private:
@@ -42,6 +46,14 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 
 		static int cmd_history_max_len;
 
+		/*! \brief Maximum amount of results (in single row mode, one per row) handled by each call to retrieveResults().
+		When this limit is reached the control is returned to the event loop and the remaining results are retrieved in a new call */
+		static const unsigned MAX_RESULTS_PER_ROUND=5000;
+
+		/*! \brief Stores the data type names (oid -> name) already retrieved for each server/database
+		so the catalog is queried only for types not seen before (see getColumnTypeNames()) */
+		static map<QString, map<unsigned, QString>> type_names_cache;
+
 		SchemaParser schparser;
 
 		//! \brief Syntax highlighter for sql input field
@@ -53,14 +65,37 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 		//! \brief Connection used to run commands specified on sql input field
 		Connection sql_cmd_conn;
 
+		/*! \brief Notifies the arrival of data in the connection's socket while a command is running.
+		This object is allocated only during the asynchronous execution of a command */
+		QSocketNotifier *sql_notifier;
+
+		//! \brief Stores the command being executed asynchronously
+		QString running_cmd;
+
+		//! \brief Indicates that the rows of the current statement's result started to be added to the results grid
+		bool res_started,
+
+		//! \brief Indicates that the last result retrieved contains tuples (SELECT-like command)
+		last_res_tuples;
+
+		//! \brief Stores the amount of rows retrieved or affected by the last result
+		int last_res_rows;
+
+		//! \brief Model that holds the tuples displayed in the results grid
+		ResultSetModel *results_model;
+
 		//! \brief Dialog for SQL save/load
 		QFileDialog sql_file_dlg;
 
 		QMenu snippets_menu,
 
-		file_menu;
+		file_menu,
+
+		export_menu;
 
-		QAction *action_save, *action_save_as, *action_load;
+		QAction *action_save, *action_save_as, *action_load,
+
+		*action_export_results, *action_export_query;
 
 		FindReplaceWidget *find_replace_wgt;
 
@@ -81,6 +116,15 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 		//! \brief Fills the result grid with the specified result set
 		void fillResultsTable(ResultSet &res);
 
+		//! \brief Finishes the asynchronous execution of the current command restoring the command buttons
+		void finishSQLCommand(void);
+
+		/*! \brief Writes the values of the model in the specified interval to the output device. When 'csv_format' is true
+		the column names are written as the first line and the values are quoted and separated by semicolons,
+		otherwise only the values are written separated by tabs. The rows are written one by one so the output never
+		needs to hold the whole content */
+		static void writeResults(QAbstractItemModel *model, int start_row, int start_col, int row_cnt, int col_cnt, bool csv_format, QIODevice &output);
+
 		static void validateSQLHistoryLength(const QString &conn_id, const QString &fmt_cmd = QString(), NumberedTextEditor *cmd_history_txt = nullptr);
 
 	protected:
@@ -103,17 +147,31 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 				The parameter store_data will make each item store the text as its data */
 		static void fillResultsTable(Catalog &catalog, ResultSet &res, QTableWidget *results_tbw, bool store_data=false);
 
-		//! \brief Copy to clipboard (in csv format) the current selected items on results grid
-		static void copySelection(QTableWidget *results_tbw, bool use_popup=true, bool csv_is_default = false);
+		/*! \brief Appends the tuples of the specified result set at the end of the results grid. The grid must
+		be already configured with the result's columns (see fillResultsTable()) */
+		static void appendResultsRows(ResultSet &res, QTableWidget *results_tbw, bool store_data=false);
+
+		/*! \brief Resizes the columns of the results grid to fit their header and the contents of the first rows only (at most max_rows).
+		When max_rows is negative the rows that can be visible in the view are used. Differently from QTableView::resizeColumnsToContents() the
+		remaining rows are never inspected so the data of large (or lazily fetched) results isn't entirely accessed */
+		static void resizeColumnsToRows(QTableView *results_tbv, int max_rows=-1);
+
+		/*! \brief Returns the names of the data types of each result's column (in the columns order). The names are
+		retrieved from the catalog only for the types that aren't cached yet for the catalog's connection */
+		static QStringList getColumnTypeNames(Catalog &catalog, ResultSet &res);
+
+		/*! \brief Copy to clipboard (in csv format) the current selected items on results grid. The grid can be any table view,
+		the values are read from its model */
+		static void copySelection(QTableView *results_tbw, bool use_popup=true, bool csv_is_default = false);
 
 		//! \brief Generates a CSV buffer based upon the selection on the results grid
-		static QByteArray generateCSVBuffer(QTableWidget *results_tbw, int start_row, int start_col, int row_cnt, int col_cnt);
+		static QByteArray generateCSVBuffer(QTableView *results_tbw, int start_row, int start_col, int row_cnt, int col_cnt);
 
 		//! \brief Generates a Plain text buffer based upon the selection on the results grid (this method does not include the column names)
-		static QByteArray generateTextBuffer(QTableWidget *results_tbw, int start_row, int start_col, int row_cnt, int col_cnt);
+		static QByteArray generateTextBuffer(QTableView *results_tbw, int start_row, int start_col, int row_cnt, int col_cnt);
 
-		//! \brief Exports the results to csv file
-		static void exportResults(QTableWidget *results_tbw);
+		//! \brief Exports the results to csv file writing the rows directly to the file
+		static void exportResults(QTableView *results_tbw);
 
 	public slots:
 		void configureSnippets(void);
@@ -137,12 +195,23 @@ class SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 		//! \brief Runs the current typed sql command
 		void runSQLCommand(void);
 
+		/*! \brief Retrieves the results of the command in execution as soon as they arrive and shows them
+		in the results grid. This slot is called whenever the server sends data to the connection */
+		void retrieveResults(void);
+
+		//! \brief Requests the server to cancel the command in execution
+		void cancelSQLCommand(void);
+
 		//! \brief Save the current typed sql command on a file
 		void saveCommands(void);
 
 		//! \brief Load a sql command from a file
 		void loadCommands(void);
 
+		/*! \brief Runs the current typed query wrapped in a COPY ... TO STDOUT command writing the rows straight to a csv file.
+		The rows are never loaded in the results grid so results of any size can be exported with a constant memory usage */
+		void exportQueryToFile(void);
+
 		//! \brief Clears the input field as well the results grid
 		int clearAll(void);
 
@@ -15,11 +15,17 @@ windows: DESTDIR = $$PWD
 
 HEADERS += src/exception.h \
            src/globalattributes.h \
-           src/pgsqlversions.h
+           src/pgsqlversions.h \
+           src/csvreader.h \
+           src/pngwriter.h
 
 SOURCES += src/exception.cpp \
            src/globalattributes.cpp \
-           src/pgsqlversions.cpp
+           src/pgsqlversions.cpp \
+           src/csvreader.cpp \
+           src/pngwriter.cpp
+
+unix|windows: LIBS += $$ZLIB_LIB
 
 # Deployment settings
 target.path = $$PRIVATELIBDIR
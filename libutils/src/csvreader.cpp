@@ -0,0 +1,128 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "csvreader.h"
+#include "exception.h"
+
+CsvReader::CsvReader(QIODevice *device, const QString &separator, const QString &text_delim)
+{
+	if(!device)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	this->device=device;
+	this->separator=(separator.isEmpty() ? QString(";") : separator);
+	this->text_delim=text_delim;
+}
+
+bool CsvReader::readRow(QStringList &values)
+{
+	QString line, line_break, value;
+	int pos=0, sep_len=separator.size(), delim_len=text_delim.size();
+	bool quoted=false, was_quoted=false;
+
+	auto readLine=[&](){
+		line=QString::fromUtf8(device->readLine());
+		line_break.clear();
+
+		//The line break is kept apart since it's part of the value only when inside a quoted value
+		while(line.endsWith(QChar('\n')) || line.endsWith(QChar('\r')))
+		{
+			line_break.prepend(line.at(line.size() - 1));
+			line.chop(1);
+		}
+	};
+
+	values.clear();
+
+	//Skipping empty lines
+	do
+	{
+		if(device->atEnd())
+			return(false);
+
+		readLine();
+	}
+	while(line.isEmpty());
+
+	while(true)
+	{
+		if(pos >= line.size())
+		{
+			//The quoted value contains a line break so the next line is part of it
+			if(quoted && !device->atEnd())
+			{
+				value+=line_break;
+				readLine();
+				pos=0;
+				continue;
+			}
+
+			values.push_back(was_quoted ? value : value.trimmed());
+			break;
+		}
+
+		if(quoted)
+		{
+			if(line.midRef(pos, delim_len)==text_delim)
+			{
+				//Two consecutive delimiters inside a quoted value represent the delimiter itself
+				if(line.midRef(pos + delim_len, delim_len)==text_delim)
+				{
+					value+=text_delim;
+					pos+=delim_len * 2;
+				}
+				else
+				{
+					quoted=false;
+					pos+=delim_len;
+				}
+			}
+			else
+				value+=line.at(pos++);
+		}
+		else if(line.midRef(pos, sep_len)==separator)
+		{
+			values.push_back(was_quoted ? value : value.trimmed());
+			value.clear();
+			was_quoted=false;
+			pos+=sep_len;
+		}
+		else if(delim_len > 0 && !was_quoted && value.trimmed().isEmpty() &&
+						line.midRef(pos, delim_len)==text_delim)
+		{
+			value.clear();
+			quoted=was_quoted=true;
+			pos+=delim_len;
+		}
+		//Characters between the closing delimiter and the next separator are ignored
+		else if(was_quoted)
+			pos++;
+		else
+			value+=line.at(pos++);
+	}
+
+	return(true);
+}
+
+int CsvReader::getProgress(void)
+{
+	if(device->isSequential() || device->size()==0)
+		return(0);
+
+	return((device->pos() * 100) / device->size());
+}
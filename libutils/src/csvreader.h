@@ -0,0 +1,54 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libutils
+\class CsvReader
+\brief Implements a reader that extracts the rows of a csv document one by one directly from a device (file, buffer, etc),
+this way huge documents can be handled without loading them entirely in memory.
+*/
+
+#ifndef CSV_READER_H
+#define CSV_READER_H
+
+#include <QIODevice>
+#include <QStringList>
+
+class CsvReader {
+	private:
+		//! \brief Device from which the rows are read
+		QIODevice *device;
+
+		//! \brief Value separator and text delimiter (the latter can be empty)
+		QString separator, text_delim;
+
+	public:
+		/*! \brief Creates a reader for the provided device (which must be already opened for reading).
+		If the separator is empty the default ';' is used */
+		CsvReader(QIODevice *device, const QString &separator, const QString &text_delim);
+
+		/*! \brief Reads the next row from the device storing its values in the provided list. Values enclosed by the text delimiter
+		can contain separators and line breaks, and two consecutive delimiters inside them are read as a single one.
+		Unquoted values are trimmed and empty lines are ignored. Returns false when there are no more rows to be read */
+		bool readRow(QStringList &values);
+
+		//! \brief Returns the percentage (0 to 100) of the device's content already read
+		int getProgress(void);
+};
+
+#endif
@@ -0,0 +1,205 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "pngwriter.h"
+#include "exception.h"
+#include <QtConcurrentMap>
+#include <zlib.h>
+
+//! \brief Converts an unsigned integer to its 4 bytes big-endian representation (as required by PNG)
+static QByteArray toBigEndian(unsigned long value)
+{
+	QByteArray buf(4, 0);
+
+	buf[0]=static_cast<char>((value >> 24) & 0xFF);
+	buf[1]=static_cast<char>((value >> 16) & 0xFF);
+	buf[2]=static_cast<char>((value >> 8) & 0xFF);
+	buf[3]=static_cast<char>(value & 0xFF);
+
+	return(buf);
+}
+
+PngWriter::PngWriter(const QString &filename, int width, int height)
+{
+	QByteArray header;
+
+	output.setFileName(filename);
+
+	if(width <= 0 || height <= 0 || !output.open(QFile::WriteOnly | QFile::Truncate))
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(filename),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	this->width=width;
+	this->height=height;
+	rows_written=0;
+	adler=adler32(0L, Z_NULL, 0);
+
+	writeData(QByteArray("\x89PNG\r\n\x1A\n", 8));
+
+	//IHDR: dimensions, 8 bits per sample, truecolor (RGB), deflate compression, adaptive filtering, no interlace
+	header.append(toBigEndian(width));
+	header.append(toBigEndian(height));
+	header.append(QByteArray("\x08\x02\x00\x00\x00", 5));
+	writeChunk("IHDR", header);
+
+	//The zlib stream header is written apart since the strips are compressed as raw deflate data
+	writeChunk("IDAT", QByteArray("\x78\x9C", 2));
+}
+
+PngWriter::~PngWriter(void)
+{
+	if(output.isOpen())
+		output.close();
+}
+
+void PngWriter::writeData(const QByteArray &data)
+{
+	if(output.write(data)!=data.size())
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(output.fileName()),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+}
+
+void PngWriter::writeChunk(const char *type, const QByteArray &data)
+{
+	QByteArray chunk;
+	unsigned long crc;
+
+	chunk.append(type, 4);
+	chunk.append(data);
+	crc=crc32(0L, reinterpret_cast<const Bytef *>(chunk.constData()), chunk.size());
+
+	writeData(toBigEndian(data.size()));
+	writeData(chunk);
+	writeData(toBigEndian(crc));
+}
+
+QByteArray PngWriter::compressStrip(const QImage &strip, unsigned long &strip_adler, unsigned long &raw_len)
+{
+	QImage img=(strip.format()==QImage::Format_RGB32 ? strip : strip.convertToFormat(QImage::Format_RGB32));
+	int row_len=(img.width() * 3) + 1;
+	QByteArray raw(row_len * img.height(), 0), buffer;
+	uchar *data=reinterpret_cast<uchar *>(raw.data());
+	const QRgb *line=nullptr;
+	QRgb prev;
+	z_stream strm;
+
+	/* Each row is preceded by the filter type. The "Sub" filter (difference to the pixel at the left) is used
+	since it depends only on the current row and gives good results on diagrams which have large flat areas */
+	for(int y=0; y < img.height(); y++)
+	{
+		line=reinterpret_cast<const QRgb *>(img.constScanLine(y));
+		prev=qRgb(0,0,0);
+		*data++=1;
+
+		for(int x=0; x < img.width(); x++)
+		{
+			*data++=static_cast<uchar>(qRed(line[x]) - qRed(prev));
+			*data++=static_cast<uchar>(qGreen(line[x]) - qGreen(prev));
+			*data++=static_cast<uchar>(qBlue(line[x]) - qBlue(prev));
+			prev=line[x];
+		}
+	}
+
+	raw_len=raw.size();
+	strip_adler=adler32(adler32(0L, Z_NULL, 0), reinterpret_cast<const Bytef *>(raw.constData()), raw.size());
+
+	strm.zalloc=Z_NULL;
+	strm.zfree=Z_NULL;
+	strm.opaque=Z_NULL;
+
+	if(deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY)!=Z_OK)
+		return(QByteArray());
+
+	/* The strip is compressed with a sync flush (instead of finishing the stream) so its output ends
+	at a byte boundary and can be concatenated to the data of the other strips */
+	buffer.resize(deflateBound(&strm, raw.size()) + 64);
+	strm.next_in=reinterpret_cast<Bytef *>(raw.data());
+	strm.avail_in=raw.size();
+	strm.next_out=reinterpret_cast<Bytef *>(buffer.data());
+	strm.avail_out=buffer.size();
+
+	if(deflate(&strm, Z_SYNC_FLUSH)!=Z_OK || strm.avail_in!=0 || strm.avail_out==0)
+		buffer.clear();
+	else
+		buffer.resize(buffer.size() - strm.avail_out);
+
+	deflateEnd(&strm);
+	return(buffer);
+}
+
+void PngWriter::writeStrips(const vector<QImage> &strips)
+{
+	vector<QByteArray> buffers(strips.size());
+	vector<unsigned long> adlers(strips.size()), lengths(strips.size());
+	vector<unsigned> idxs;
+	int rows=0;
+
+	for(unsigned idx=0; idx < strips.size(); idx++)
+	{
+		rows+=strips[idx].height();
+		idxs.push_back(idx);
+
+		if(strips[idx].width()!=width || strips[idx].height()==0)
+			throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(output.fileName()),
+											ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	if(!output.isOpen() || rows_written + rows > height)
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(output.fileName()),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	QtConcurrent::blockingMap(idxs, [&](unsigned idx){
+		buffers[idx]=compressStrip(strips[idx], adlers[idx], lengths[idx]);
+	});
+
+	//The compressed strips are appended in order, updating the checksum of the whole uncompressed stream
+	for(unsigned idx=0; idx < strips.size(); idx++)
+	{
+		if(buffers[idx].isEmpty())
+			throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(output.fileName()),
+											ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		writeChunk("IDAT", buffers[idx]);
+		adler=adler32_combine(adler, adlers[idx], lengths[idx]);
+		rows_written+=strips[idx].height();
+	}
+}
+
+int PngWriter::getRowsWritten(void)
+{
+	return(rows_written);
+}
+
+void PngWriter::close(void)
+{
+	if(!output.isOpen())
+		return;
+
+	if(rows_written!=height)
+	{
+		output.close();
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(output.fileName()),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	//Empty final block (fixed Huffman codes) followed by the stream checksum closes the zlib stream
+	writeChunk("IDAT", QByteArray("\x03\x00", 2) + toBigEndian(adler));
+	writeChunk("IEND", QByteArray());
+	output.close();
+}
@@ -0,0 +1,76 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libutils
+\class PngWriter
+\brief Implements a PNG encoder that writes the image to a file strip by strip (a strip being a set of
+consecutive rows), this way images far bigger than what can be allocated at once can be generated.
+The strips passed at once are filtered and compressed in parallel before being appended to the file.
+*/
+
+#ifndef PNG_WRITER_H
+#define PNG_WRITER_H
+
+#include <QFile>
+#include <QImage>
+#include <vector>
+
+using namespace std;
+
+class PngWriter {
+	private:
+		//! \brief File in which the image is being written
+		QFile output;
+
+		//! \brief Image dimensions and the amount of rows already written
+		int width, height, rows_written;
+
+		//! \brief Adler-32 checksum of the whole uncompressed data (required at the end of the zlib stream)
+		unsigned long adler;
+
+		//! \brief Writes a chunk (length, type, data and CRC) to the output file
+		void writeChunk(const char *type, const QByteArray &data);
+
+		//! \brief Writes the raw data to the output file raising an error if something goes wrong
+		void writeData(const QByteArray &data);
+
+		//! \brief Filters and compresses the rows of a strip generating an independent deflate block sequence
+		static QByteArray compressStrip(const QImage &strip, unsigned long &strip_adler, unsigned long &raw_len);
+
+	public:
+		/*! \brief Creates the file and writes the PNG header for an RGB image with the provided dimensions.
+		Raises an error if the file can't be written */
+		PngWriter(const QString &filename, int width, int height);
+
+		~PngWriter(void);
+
+		/*! \brief Appends the strips to the image. All strips must have the same width of the image and their
+		rows are written in the order they appear in the vector */
+		void writeStrips(const vector<QImage> &strips);
+
+		//! \brief Returns the amount of rows already written
+		int getRowsWritten(void);
+
+		/*! \brief Finishes the compressed stream and closes the file. Raises an error if the amount
+		of written rows differs from the image height */
+		void close(void);
+};
+
+#endif
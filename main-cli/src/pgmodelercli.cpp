@@ -48,6 +48,8 @@ const QString PgModelerCLI::FIX_TRIES=QString("--fix-tries");
 const QString PgModelerCLI::ZOOM_FACTOR=QString("--zoom");
 const QString PgModelerCLI::USE_TMP_NAMES=QString("--use-tmp-names");
 const QString PgModelerCLI::DBM_MIME_TYPE=QString("--dbm-mime-type");
+const QString PgModelerCLI::TRUSTED_INPUT=QString("--trusted-input");
+const QString PgModelerCLI::BATCH_SIZE=QString("--batch-size");
 const QString PgModelerCLI::INSTALL=QString("install");
 const QString PgModelerCLI::UNINSTALL=QString("uninstall");
 
@@ -118,6 +120,7 @@ PgModelerCLI::PgModelerCLI(int argc, char **argv) :  QApplication(argc, argv)
 			model=new DatabaseModel;
 			xmlparser=model->getXMLParser();
 			silent_mode=(parsed_opts.count(SILENT));
+			XMLParser::setTrustedInputMode(parsed_opts.count(TRUSTED_INPUT));
 
 			//If the export is to png or svg loads additional configurations
 			if(parsed_opts.count(EXPORT_TO_PNG) || parsed_opts.count(EXPORT_TO_SVG))
@@ -205,6 +208,8 @@ void PgModelerCLI::initializeOptions(void)
 	long_opts[ZOOM_FACTOR]=true;
 	long_opts[USE_TMP_NAMES]=false;
 	long_opts[DBM_MIME_TYPE]=true;
+	long_opts[TRUSTED_INPUT]=false;
+	long_opts[BATCH_SIZE]=true;
 
 	short_opts[INPUT]=QString("-i");
 	short_opts[OUTPUT]=QString("-o");
@@ -235,6 +240,8 @@ void PgModelerCLI::initializeOptions(void)
 	short_opts[ZOOM_FACTOR]=QString("-z");
 	short_opts[USE_TMP_NAMES]=QString("-n");
 	short_opts[DBM_MIME_TYPE]=QString("-m");
+	short_opts[TRUSTED_INPUT]=QString("-r");
+	short_opts[BATCH_SIZE]=QString("-B");
 }
 
 bool PgModelerCLI::isOptionRecognized(QString &op, bool &accepts_val)
@@ -277,6 +284,7 @@ accepted structure. All available options are described below.") << endl;
 	out << trUtf8("  %1, %2\t\t   List available connections on %3 file.").arg(short_opts[LIST_CONNS]).arg(LIST_CONNS).arg(GlobalAttributes::CONNECTIONS_CONF + GlobalAttributes::CONFIGURATION_EXT) << endl;
 	out << trUtf8("  %1, %2\t\t   Version of generated SQL code. Only for file or dbms export.").arg(short_opts[PGSQL_VER]).arg(PGSQL_VER) << endl;
 	out << trUtf8("  %1, %2\t\t\t   Silent execution. Only critical errors are shown during process.").arg(short_opts[SILENT]).arg(SILENT) << endl;
+	out << trUtf8("  %1, %2\t\t   Skips the DTD validation of the input file when it was written by pgModeler.").arg(short_opts[TRUSTED_INPUT]).arg(TRUSTED_INPUT) << endl;
 	out << trUtf8("  %1, %2\t\t\t   Show this help menu.").arg(short_opts[HELP]).arg(HELP) << endl;
 	out << endl;
 	out << trUtf8("PNG and SVG export options: ") << endl;
@@ -292,6 +300,7 @@ accepted structure. All available options are described below.") << endl;
 	out << trUtf8("  %1, %2\t\t   Runs the DROP commands attached to SQL-enabled objects.").arg(short_opts[DROP_OBJECTS]).arg(DROP_OBJECTS) << endl;
 	out << trUtf8("  %1, %2\t\t   Simulates a export process. Actually executes all steps but undoing any modification.").arg(short_opts[SIMULATE]).arg(SIMULATE) << endl;
 	out << trUtf8("  %1, %2\t\t   Generates temporary names for database, roles and tablespaces when in simulation mode.").arg(short_opts[USE_TMP_NAMES]).arg(USE_TMP_NAMES) << endl;
+	out << trUtf8("  %1, %2=[SIZE]\t   Sends up to SIZE commands at once to the server, each batch in a transaction (default: 1).").arg(short_opts[BATCH_SIZE]).arg(BATCH_SIZE) << endl;
 	out << trUtf8("  %1, %2=[ALIAS]\t   Connection configuration alias to be used.").arg(short_opts[CONN_ALIAS]).arg(CONN_ALIAS) << endl;
 	out << trUtf8("  %1, %2=[HOST]\t\t   PostgreSQL host which export will operate.").arg(short_opts[HOST]).arg(HOST) << endl;
 	out << trUtf8("  %1, %2=[PORT]\t\t   PostgreSQL host listening port.").arg(short_opts[PORT]).arg(PORT) << endl;
@@ -476,6 +485,9 @@ int PgModelerCLI::exec(void)
 					if(parsed_opts.count(IGNORE_ERROR_CODES))
 						export_hlp.setIgnoredErrors(parsed_opts[IGNORE_ERROR_CODES].split(','));
 
+					if(parsed_opts.count(BATCH_SIZE))
+						export_hlp.setBatchSize(parsed_opts[BATCH_SIZE].toUInt());
+
 					export_hlp.exportToDBMS(model, connection, parsed_opts[PGSQL_VER],
 											parsed_opts.count(IGNORE_DUPLICATES) > 0,
 											parsed_opts.count(DROP_DATABASE) > 0,
@@ -117,6 +117,8 @@ class PgModelerCLI: public QApplication {
 		ZOOM_FACTOR,
 		USE_TMP_NAMES,
 		DBM_MIME_TYPE,
+		TRUSTED_INPUT,
+		BATCH_SIZE,
 		INSTALL,
 		UNINSTALL,
 
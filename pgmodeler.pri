@@ -10,7 +10,7 @@
 # Refactored code: https://github.com/pgmodeler/pgmodeler
 
 # General Qt settings
-QT += core widgets printsupport network svg
+QT += core widgets printsupport network svg concurrent
 CONFIG += ordered qt stl rtti exceptions warn_on c++11
 TEMPLATE = subdirs
 MOC_DIR = moc
@@ -129,7 +129,7 @@ DEFINES += BINDIR=\\\"$${BINDIR}\\\" \
            SCHEMASDIR=\\\"$${SCHEMASDIR}\\\"
 
 
-# pgModeler depends on libpq and libxml2 this way to variables
+# pgModeler depends on libpq, libxml2 and zlib this way some variables
 # are define so the compiler can find the libs at link time.
 #
 # PGSQL_LIB -> Full path to libpq.(so | dll | dylib)
@@ -137,12 +137,16 @@ DEFINES += BINDIR=\\\"$${BINDIR}\\\" \
 #
 # XML_LIB   -> Full path to libxml2.(so | dll | dylib)
 # XML_INC   -> Root path where XML2 includes can be found
+#
+# ZLIB_LIB  -> Full path to zlib.(so | dll | dylib)
+# ZLIB_INC  -> Root path where zlib includes can be found
 
 unix:!macx {
   CONFIG += link_pkgconfig
-  PKGCONFIG = libpq libxml-2.0
+  PKGCONFIG = libpq libxml-2.0 zlib
   PGSQL_LIB = -lpq
   XML_LIB = -lxml2
+  ZLIB_LIB = -lz
 }
 
 macx {
@@ -150,7 +154,9 @@ macx {
   PGSQL_INC = /Library/PostgreSQL/9.6/include
   XML_INC = /Applications/Xcode.app/Contents/Developer/Platforms/MacOSX.platform/Developer/SDKs/MacOSX.sdk/usr/include/libxml2
   XML_LIB = /usr/lib/libxml2.dylib
-  INCLUDEPATH += $$PGSQL_INC $$XML_INC
+  ZLIB_INC = /Applications/Xcode.app/Contents/Developer/Platforms/MacOSX.platform/Developer/SDKs/MacOSX.sdk/usr/include
+  ZLIB_LIB = /usr/lib/libz.dylib
+  INCLUDEPATH += $$PGSQL_INC $$XML_INC $$ZLIB_INC
 }
 
 windows {
@@ -158,11 +164,13 @@ windows {
   !defined(PGSQL_INC, var): PGSQL_INC = C:/PostgreSQL/9.6/include
   !defined(XML_INC, var): XML_INC = C:/PostgreSQL/9.6/include
   !defined(XML_LIB, var): XML_LIB = C:/PostgreSQL/9.6/bin/libxml2.dll
+  !defined(ZLIB_INC, var): ZLIB_INC = C:/PostgreSQL/9.6/include
+  !defined(ZLIB_LIB, var): ZLIB_LIB = C:/PostgreSQL/9.6/bin/zlib1.dll
 
   # Workaround to solve bug of timespec struct on MingW + PostgreSQL < 9.4
   QMAKE_CXXFLAGS+="-DHAVE_STRUCT_TIMESPEC"
 
-  INCLUDEPATH += "$$PGSQL_INC" "$$XML_INC"
+  INCLUDEPATH += "$$PGSQL_INC" "$$XML_INC" "$$ZLIB_INC"
 }
 
 macx | windows {
@@ -190,6 +198,18 @@ macx | windows {
     VALUE = $$XML_INC
   }
 
+  !exists($$ZLIB_LIB) {
+    PKG_ERROR = "zlib libraries"
+    VARIABLE = "ZLIB_LIB"
+    VALUE = $$ZLIB_LIB
+  }
+
+  !exists($$ZLIB_INC/zlib.h) {
+    PKG_ERROR = "zlib headers"
+    VARIABLE = "ZLIB_INC"
+    VALUE = $$ZLIB_INC
+  }
+
   !isEmpty(PKG_ERROR) {
     warning("$$PKG_ERROR were not found at \"$$VALUE\"!")
     warning("Please correct the value of $$VARIABLE and try again!")
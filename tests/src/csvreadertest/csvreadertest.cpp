@@ -0,0 +1,53 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "csvreader.h"
+
+class CsvReaderTest: public QObject {
+  private:
+    Q_OBJECT
+
+  private slots:
+		void readsQuotedValuesWithSeparatorsAndLineBreaks(void);
+};
+
+void CsvReaderTest::readsQuotedValuesWithSeparatorsAndLineBreaks(void)
+{
+	QByteArray data("id;name;notes\n\n 1 ;\"a;b\";\"first\nsecond\"\n2;\"say \"\"hi\"\"\";\n");
+	QBuffer buffer(&data);
+	QStringList values;
+
+	buffer.open(QIODevice::ReadOnly);
+	CsvReader reader(&buffer, QString(";"), QString("\""));
+
+	QCOMPARE(reader.readRow(values), true);
+	QCOMPARE(values, QStringList({ "id", "name", "notes" }));
+
+	QCOMPARE(reader.readRow(values), true);
+	QCOMPARE(values, QStringList({ "1", "a;b", "first\nsecond" }));
+
+	QCOMPARE(reader.readRow(values), true);
+	QCOMPARE(values, QStringList({ "2", "say \"hi\"", "" }));
+
+	QCOMPARE(reader.readRow(values), false);
+	QCOMPARE(reader.getProgress(), 100);
+}
+
+QTEST_MAIN(CsvReaderTest)
+#include "csvreadertest.moc"
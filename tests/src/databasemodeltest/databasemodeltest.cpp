@@ -26,8 +26,89 @@ class DatabaseModelTest: public QObject {
 	private slots:
 		void saveObjectsMetadata(void);
 		void loadObjectsMetadata(void);
+		void loadLargeModel(void);
+		void streamedCodeMatchesGeneratedCode(void);
+		void sqlStatementsCarryTheirObjects(void);
+		void objectReferencesFollowModelChanges(void);
+		void relationshipValidationKeepsUnlinkedRelsConnected(void);
 };
 
+/* Generates the SQL code of the whole model in the same way DatabaseModel::getCodeDefinition() did before
+the code started to be streamed: all objects' code is concatenated in the attributes and the model's schema
+is parsed once. This is used as reference to check the streamed code. Since the functions' parameters of base
+types can't be converted outside DatabaseModel, the model must not have base types */
+static QString getReferenceSQLCode(DatabaseModel &dbmodel)
+{
+	attribs_map attribs;
+	SchemaParser schparser;
+	BaseObject *object=nullptr;
+	ObjectType obj_type;
+	bool sql_disabled=false;
+	unsigned def_type=SchemaParser::SQL_DEFINITION;
+	QString def, attrib=ParsersAttributes::OBJECTS, attrib_aux, search_path=QString("pg_catalog,public");
+
+	attribs[ParsersAttributes::SHELL_TYPES]=QString();
+	attribs[ParsersAttributes::PERMISSION]=QString();
+	attribs[ParsersAttributes::SCHEMA]=QString();
+	attribs[ParsersAttributes::TABLESPACE]=QString();
+	attribs[ParsersAttributes::ROLE]=QString();
+	attribs[ParsersAttributes::FUNCTION]=(dbmodel.getObjectCount(OBJ_FUNCTION) > 0 ? ParsersAttributes::_TRUE_ : QString());
+
+	for(auto &obj_itr : dbmodel.getCreationOrder(def_type))
+	{
+		object=obj_itr.second;
+		obj_type=object->getObjectType();
+
+		if(obj_type==OBJ_DATABASE)
+		{
+			sql_disabled=dbmodel.isSQLDisabled();
+			dbmodel.setSQLDisabled(true);
+			attribs[dbmodel.getSchemaName()]+=dbmodel.__getCodeDefinition(def_type);
+			dbmodel.setSQLDisabled(sql_disabled);
+		}
+		else if(obj_type==OBJ_PERMISSION)
+			attribs[ParsersAttributes::PERMISSION]+=object->getCodeDefinition(def_type);
+		else if(obj_type==OBJ_CONSTRAINT)
+			attribs[attrib]+=dynamic_cast<Constraint *>(object)->getCodeDefinition(def_type, true);
+		else if(obj_type==OBJ_ROLE || obj_type==OBJ_TABLESPACE ||  obj_type==OBJ_SCHEMA)
+		{
+			attrib_aux=BaseObject::getSchemaName(obj_type);
+
+			if(obj_type==OBJ_TABLESPACE && !object->isSystemObject())
+			{
+				sql_disabled=object->isSQLDisabled();
+				object->setSQLDisabled(true);
+				attribs[attrib_aux]+=object->getCodeDefinition(def_type);
+				object->setSQLDisabled(sql_disabled);
+			}
+			else if((obj_type!=OBJ_SCHEMA && !object->isSystemObject()) ||
+							(obj_type==OBJ_SCHEMA && object->getName()!=QString("public") && object->getName()!=QString("pg_catalog")))
+			{
+				if(obj_type==OBJ_SCHEMA)
+					search_path+=QString(",") + object->getName(true);
+
+				attribs[attrib_aux]+=object->getCodeDefinition(def_type);
+			}
+		}
+		else if(!object->isSystemObject())
+			attribs[attrib]+=object->getCodeDefinition(def_type);
+	}
+
+	attribs[ParsersAttributes::SEARCH_PATH]=search_path;
+	attribs[ParsersAttributes::MODEL_AUTHOR]=dbmodel.getAuthor();
+	attribs[ParsersAttributes::PGMODELER_VERSION]=GlobalAttributes::PGMODELER_VERSION;
+	attribs[ParsersAttributes::EXPORT_TO_FILE]=ParsersAttributes::_TRUE_;
+	def=schparser.getCodeDefinition(ParsersAttributes::DB_MODEL, attribs, def_type);
+
+	if(dbmodel.isPrependedAtBOD())
+		def=QString("-- Prepended SQL commands --\n") + dbmodel.getPrependedSQL() + QString("\n---\n\n") + def;
+
+	if(dbmodel.isAppendAtEOD())
+		def+=QString("-- Appended SQL commands --\n") + dbmodel.getAppendedSQL() + QString("\n---\n");
+
+	return(def);
+}
+
 void DatabaseModelTest::saveObjectsMetadata(void)
 {
 	DatabaseModel dbmodel;
@@ -74,5 +155,296 @@ void DatabaseModelTest::loadObjectsMetadata(void)
 	}
 }
 
+void DatabaseModelTest::loadLargeModel(void)
+{
+	QTextStream out(stdout);
+	QString output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DIR_SEPARATOR + QString("large_model.dbm");
+	unsigned tab_count=4000;
+
+	try
+	{
+		DatabaseModel gen_model;
+		Schema *public_sch=nullptr;
+		Table *table=nullptr;
+		Column *column=nullptr;
+
+		gen_model.createSystemObjects(true);
+		public_sch=gen_model.getSchema(QString("public"));
+
+		for(unsigned i=0; i < tab_count; i++)
+		{
+			table=new Table;
+			table->setName(QString("table_%1").arg(i));
+			table->setSchema(public_sch);
+
+			column=new Column;
+			column->setName(QString("id"));
+			column->setType(PgSQLType(QString("integer")));
+			table->addColumn(column);
+
+			gen_model.addTable(table);
+		}
+
+		gen_model.saveModel(output, SchemaParser::XML_DEFINITION);
+
+		//Loading the model relies on name lookups for each referenced object (schemas, tables, types)
+		QBENCHMARK_ONCE
+		{
+			DatabaseModel dbmodel;
+
+			dbmodel.createSystemObjects(false);
+			dbmodel.loadModel(output);
+			QCOMPARE(dbmodel.getObjectCount(OBJ_TABLE), tab_count);
+			QVERIFY(dbmodel.getObject(QString("public.table_%1").arg(tab_count - 1), OBJ_TABLE));
+		}
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << endl;
+		QFAIL("Failed to generate/load the model");
+	}
+}
+
+void DatabaseModelTest::streamedCodeMatchesGeneratedCode(void)
+{
+	DatabaseModel dbmodel;
+	QTextStream out(stdout);
+	QString input=SAMPLESDIR + GlobalAttributes::DIR_SEPARATOR + QString("demo.dbm"),
+			output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DIR_SEPARATOR + QString("demo_streamed.sql");
+	QByteArray ref_def;
+	QFile file(output);
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(input);
+
+		for(auto &type : *dbmodel.getObjectList(OBJ_TYPE))
+			QVERIFY(dynamic_cast<Type *>(type)->getConfiguration()!=Type::BASE_TYPE);
+
+		ref_def.append(getReferenceSQLCode(dbmodel).toUtf8());
+		dbmodel.saveModel(output, SchemaParser::SQL_DEFINITION);
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << endl;
+		QFAIL("Failed to generate the model's code");
+	}
+
+	QVERIFY(file.open(QFile::ReadOnly));
+	QCOMPARE(file.readAll(), ref_def);
+}
+
+void DatabaseModelTest::sqlStatementsCarryTheirObjects(void)
+{
+	DatabaseModel dbmodel;
+	QTextStream out(stdout);
+	QString input=SAMPLESDIR + GlobalAttributes::DIR_SEPARATOR + QString("demo.dbm");
+	vector<DatabaseModel::SQLStatement> stmts, buf_stmts;
+	Table *table=nullptr;
+	bool found=false;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(input);
+		stmts=dbmodel.getSQLStatements(false);
+		DatabaseModel::splitSQLStatements(dbmodel.getCodeDefinition(SchemaParser::SQL_DEFINITION, false), nullptr, false, buf_stmts);
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << endl;
+		QFAIL("Failed to generate the model's statements");
+	}
+
+	//The statements generated per object must be the same ones found when splitting the whole model's code
+	QCOMPARE(stmts.size(), buf_stmts.size());
+
+	for(unsigned i=0; i < stmts.size(); i++)
+		QCOMPARE(stmts[i].sql, buf_stmts[i].sql);
+
+	//Each enabled table must have its CREATE statement attached to it
+	for(unsigned i=0; i < dbmodel.getObjectCount(OBJ_TABLE); i++)
+	{
+		table=dbmodel.getTable(i);
+		found=false;
+
+		for(auto &stmt : stmts)
+		{
+			if(stmt.object==table && stmt.obj_type==OBJ_TABLE && stmt.sql.startsWith(QString("CREATE")))
+			{
+				QCOMPARE(stmt.obj_name, table->getSignature());
+				found=true;
+				break;
+			}
+		}
+
+		QCOMPARE(found, !table->isSQLDisabled());
+	}
+}
+
+void DatabaseModelTest::objectReferencesFollowModelChanges(void)
+{
+	QTextStream out(stdout);
+	DatabaseModel dbmodel;
+	Schema *public_sch=nullptr;
+	Table *table=nullptr, *prev_table=nullptr;
+	Column *column=nullptr;
+	Sequence *seq1=new Sequence, *seq2=new Sequence;
+	vector<Table *> tables;
+	vector<BaseObject *> refs;
+	unsigned tab_count=3000;
+
+	try
+	{
+		dbmodel.createSystemObjects(true);
+		public_sch=dbmodel.getSchema(QString("public"));
+
+		seq1->setName(QString("seq1"));
+		seq1->setSchema(public_sch);
+		dbmodel.addSequence(seq1);
+
+		seq2->setName(QString("seq2"));
+		seq2->setSchema(public_sch);
+		dbmodel.addSequence(seq2);
+
+		//Each table has a column which data type is the previous table
+		for(unsigned i=0; i < tab_count; i++)
+		{
+			table=new Table;
+			table->setName(QString("table_%1").arg(i));
+			table->setSchema(public_sch);
+
+			column=new Column;
+			column->setName(QString("id"));
+			column->setType(PgSQLType(QString("integer")));
+			table->addColumn(column);
+
+			if(prev_table)
+			{
+				column=new Column;
+				column->setName(QString("prev"));
+				column->setType(PgSQLType(prev_table));
+				table->addColumn(column);
+			}
+
+			dbmodel.addTable(table);
+			tables.push_back(table);
+			prev_table=table;
+		}
+
+		//Changing the references of an object that is already on the model
+		column=tables[0]->getColumn(QString("id"));
+		column->setSequence(seq1);
+		dbmodel.getObjectReferences(seq1, refs);
+		QCOMPARE(refs.size(), static_cast<size_t>(1));
+		QVERIFY(refs[0]==column);
+
+		column->setSequence(seq2);
+		dbmodel.getObjectReferences(seq1, refs);
+		QVERIFY(refs.empty());
+		dbmodel.getObjectReferences(seq2, refs);
+		QCOMPARE(refs.size(), static_cast<size_t>(1));
+
+		dbmodel.getObjectReferences(tables[0], refs, true, true);
+		QVERIFY(!refs.empty());
+		QVERIFY(refs[0]==tables[1]->getColumn(QString("prev")));
+		QVERIFY_EXCEPTION_THROWN(dbmodel.removeTable(tables[0]), Exception);
+
+		column->setSequence(nullptr);
+		dbmodel.getObjectReferences(seq2, refs);
+		QVERIFY(refs.empty());
+
+		//Removing the tables in the reverse order of creation so each one is no longer referenced
+		while(!tables.empty())
+		{
+			dbmodel.removeTable(tables.back());
+			delete(tables.back());
+			tables.pop_back();
+		}
+
+		QCOMPARE(dbmodel.getObjectCount(OBJ_TABLE), static_cast<unsigned>(0));
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << endl;
+		QFAIL("Failed to create/remove the objects");
+	}
+}
+
+void DatabaseModelTest::relationshipValidationKeepsUnlinkedRelsConnected(void)
+{
+	QTextStream out(stdout);
+	DatabaseModel dbmodel;
+	Schema *public_sch=nullptr;
+	Table *table=nullptr;
+	Column *column=nullptr;
+	Constraint *pk=nullptr;
+	Relationship *rel_ab=nullptr, *rel_cd=nullptr;
+	vector<Table *> tables;
+	Column *gen_col_cd=nullptr;
+	QString gen_col_name;
+
+	try
+	{
+		dbmodel.createSystemObjects(true);
+		public_sch=dbmodel.getSchema(QString("public"));
+
+		for(unsigned i=0; i < 4; i++)
+		{
+			table=new Table;
+			table->setName(QString("table_%1").arg(i));
+			table->setSchema(public_sch);
+
+			column=new Column;
+			column->setName(QString("id"));
+			column->setType(PgSQLType(QString("integer")));
+			table->addColumn(column);
+
+			pk=new Constraint;
+			pk->setName(QString("table_%1_pk").arg(i));
+			pk->setConstraintType(ConstraintType::primary_key);
+			pk->addColumn(column, Constraint::SOURCE_COLS);
+			table->addConstraint(pk);
+
+			dbmodel.addTable(table);
+			tables.push_back(table);
+		}
+
+		//Two relationships that aren't linked to each other (table_0 -> table_1 and table_2 -> table_3)
+		rel_ab=new Relationship(BaseRelationship::RELATIONSHIP_1N, tables[0], tables[1]);
+		dbmodel.addRelationship(rel_ab);
+		rel_cd=new Relationship(BaseRelationship::RELATIONSHIP_1N, tables[2], tables[3]);
+		dbmodel.addRelationship(rel_cd);
+
+		QCOMPARE(rel_ab->getGeneratedColumns().size(), static_cast<size_t>(1));
+		QCOMPARE(rel_cd->getGeneratedColumns().size(), static_cast<size_t>(1));
+		gen_col_name=rel_ab->getGeneratedColumns().at(0)->getName();
+		gen_col_cd=rel_cd->getGeneratedColumns().at(0);
+
+		//Changing the primary key column of table_0 must reconnect only the relationship linked to it
+		column=tables[0]->getColumn(QString("id"));
+		column->setType(PgSQLType(QString("bigint")));
+		dbmodel.validateRelationships(column, tables[0]);
+
+		QVERIFY(!rel_ab->isInvalidated());
+		QVERIFY(!rel_cd->isInvalidated());
+		QVERIFY(rel_ab->getGeneratedColumns().at(0)->getType()==QString("bigint"));
+		QVERIFY(rel_cd->getGeneratedColumns().at(0)==gen_col_cd);
+
+		//Removing a relationship keeps the unlinked one untouched too
+		dbmodel.removeRelationship(rel_ab);
+		delete(rel_ab);
+		QVERIFY(!rel_cd->isInvalidated());
+		QVERIFY(rel_cd->getGeneratedColumns().at(0)==gen_col_cd);
+		QVERIFY(!tables[1]->getColumn(gen_col_name));
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << endl;
+		QFAIL("Failed to validate the relationships");
+	}
+}
+
 QTEST_MAIN(DatabaseModelTest)
 #include "databasemodeltest.moc"
@@ -0,0 +1,75 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include <QtTest/QtTest>
+#include "pngwriter.h"
+#include "exception.h"
+
+class PngWriterTest: public QObject {
+  private:
+    Q_OBJECT
+
+  private slots:
+		void writesImageInStripsReadableByQt(void);
+		void raisesErrorOnIncompleteImage(void);
+};
+
+void PngWriterTest::writesImageInStripsReadableByQt(void)
+{
+	QTemporaryDir tmp_dir;
+	QString filename=tmp_dir.path() + QString("/strips.png");
+	QImage img(37, 50, QImage::Format_RGB32), loaded;
+	vector<QImage> strips;
+
+	for(int y=0; y < img.height(); y++)
+	{
+		for(int x=0; x < img.width(); x++)
+			img.setPixel(x, y, qRgb((x * 7) % 256, (y * 5) % 256, (x * y) % 256));
+	}
+
+	PngWriter png(filename, img.width(), img.height());
+
+	strips.push_back(img.copy(0, 0, img.width(), 20));
+	strips.push_back(img.copy(0, 20, img.width(), 20));
+	png.writeStrips(strips);
+
+	strips.clear();
+	strips.push_back(img.copy(0, 40, img.width(), 10));
+	png.writeStrips(strips);
+	png.close();
+
+	QCOMPARE(loaded.load(filename), true);
+	QCOMPARE(loaded.size(), img.size());
+	QCOMPARE(loaded.convertToFormat(QImage::Format_RGB32), img);
+}
+
+void PngWriterTest::raisesErrorOnIncompleteImage(void)
+{
+	QTemporaryDir tmp_dir;
+	PngWriter png(tmp_dir.path() + QString("/incomplete.png"), 10, 10);
+	QImage strip(10, 5, QImage::Format_RGB32);
+
+	strip.fill(Qt::white);
+	png.writeStrips({ strip });
+
+	QVERIFY_EXCEPTION_THROWN(png.close(), Exception);
+}
+
+QTEST_MAIN(PngWriterTest)
+#include "pngwritertest.moc"
@@ -0,0 +1,104 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+
+#include <QtTest/QtTest>
+#include "relationshiprouter.h"
+
+class RelationshipRouterTest: public QObject {
+  private:
+    Q_OBJECT
+
+		//! \brief The router uses the views only as keys so fake addresses are enough to identify them
+		template<class Class>
+		static Class *getFakeView(quintptr id)
+		{
+			return(reinterpret_cast<Class *>(id));
+		}
+
+  private slots:
+		void routesAroundTablesUsingOrthogonalSegments(void);
+		void invalidatesOnlyRoutesAffectedByMovedTable(void);
+};
+
+void RelationshipRouterTest::routesAroundTablesUsingOrthogonalSegments(void)
+{
+	RelationshipRouter router;
+	BaseTableView *src_tab=getFakeView<BaseTableView>(1),
+			*dst_tab=getFakeView<BaseTableView>(2),
+			*middle_tab=getFakeView<BaseTableView>(3);
+	QRectF src_rect(0, 50, 100, 100), dst_rect(400, 50, 100, 100), middle_rect(200, 0, 100, 200);
+	vector<QPointF> route;
+	vector<RelationshipView *> invalid_rels;
+
+	router.updateObstacle(middle_tab, middle_rect);
+	route=router.getRoute(getFakeView<RelationshipView>(1), src_tab, dst_tab, src_rect, dst_rect, invalid_rels);
+	QVERIFY(invalid_rels.empty());
+
+	QVERIFY(route.size() > 2);
+	QVERIFY(src_rect.contains(route.front()));
+	QVERIFY(dst_rect.contains(route.back()));
+
+	for(unsigned i=0; i + 1 < route.size(); i++)
+	{
+		QVERIFY(route[i].x()==route[i+1].x() || route[i].y()==route[i+1].y());
+		QVERIFY(!middle_rect.intersects(QRectF(route[i], route[i+1]).normalized().adjusted(-0.5, -0.5, 0.5, 0.5)));
+	}
+}
+
+void RelationshipRouterTest::invalidatesOnlyRoutesAffectedByMovedTable(void)
+{
+	RelationshipRouter router;
+	RelationshipView *near_rel=getFakeView<RelationshipView>(1),
+			*far_rel=getFakeView<RelationshipView>(2);
+	BaseTableView *tabs[5];
+	QRectF rects[]={ QRectF(0, 0, 100, 100), QRectF(400, 0, 100, 100),
+									 QRectF(0, 2000, 100, 100), QRectF(400, 2000, 100, 100) };
+	vector<QPointF> near_route, far_route;
+	vector<RelationshipView *> invalid_rels;
+
+	for(quintptr i=0; i < 5; i++)
+		tabs[i]=getFakeView<BaseTableView>(i + 1);
+
+	near_route=router.getRoute(near_rel, tabs[0], tabs[1], rects[0], rects[1], invalid_rels);
+	far_route=router.getRoute(far_rel, tabs[2], tabs[3], rects[2], rects[3], invalid_rels);
+	QVERIFY(invalid_rels.empty());
+
+	//A table placed far from both routes doesn't invalidate them
+	QVERIFY(router.updateObstacle(tabs[4], QRectF(2000, 1000, 100, 100)).empty());
+
+	//Moving the table over the first route invalidates only that route
+	invalid_rels=router.updateObstacle(tabs[4], QRectF(200, -50, 100, 200));
+	QCOMPARE(invalid_rels.size(), static_cast<size_t>(1));
+	QCOMPARE(invalid_rels[0], near_rel);
+
+	//The invalidated route is recomputed around the table while the other one is kept
+	invalid_rels.clear();
+	QVERIFY(router.getRoute(near_rel, tabs[0], tabs[1], rects[0], rects[1], invalid_rels)!=near_route);
+	QVERIFY(router.getRoute(far_rel, tabs[2], tabs[3], rects[2], rects[3], invalid_rels)==far_route);
+	QVERIFY(invalid_rels.empty());
+
+	//A table moved while computing a route informs the other routes it invalidated
+	router.getRoute(far_rel, tabs[2], tabs[3], rects[2], QRectF(150, -100, 200, 300), invalid_rels);
+	QCOMPARE(invalid_rels.size(), static_cast<size_t>(1));
+	QCOMPARE(invalid_rels[0], near_rel);
+}
+
+QTEST_MAIN(RelationshipRouterTest)
+#include "relationshiproutertest.moc"
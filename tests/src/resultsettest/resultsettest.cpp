@@ -0,0 +1,136 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2017 - Raphael Araújo e Silva <raphael@pgmodeler.com.br>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "resultset.h"
+
+//! \brief Exposes the protected members of ResultSet so the test can create results without a server
+class TestResultSet: public ResultSet {
+	public:
+		TestResultSet(void) : ResultSet() {}
+		TestResultSet(PGresult *res) : ResultSet(res) {}
+
+		PGresult *getResult(void)
+		{
+			return(sql_result);
+		}
+};
+
+class ResultSetTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Amount of tuples of the result used by the benchmarks
+		static const int TUPLE_COUNT=1000000;
+
+		//! \brief Creates a two columns (integer, text) result containing the specified amount of tuples
+		PGresult *createResult(int tuple_count);
+
+	private slots:
+		void moveResultWithoutCopy(void);
+		void columnDataReferencesResult(void);
+		void benchmarkLargeResultCopy(void);
+		void benchmarkLargeResultMove(void);
+};
+
+PGresult *ResultSetTest::createResult(int tuple_count)
+{
+	PGresult *res=PQmakeEmptyPGresult(nullptr, PGRES_TUPLES_OK);
+	PGresAttDesc attrs[2]={ { const_cast<char *>("id"), 0, 0, 0, 23, 4, -1 },
+													{ const_cast<char *>("name"), 0, 0, 0, 25, -1, -1 } };
+	QByteArray id, name;
+
+	PQsetResultAttrs(res, 2, attrs);
+
+	for(int row=0; row < tuple_count; row++)
+	{
+		id=QByteArray::number(row);
+		name=QByteArray("name_") + id;
+		PQsetvalue(res, row, 0, id.data(), id.size());
+		PQsetvalue(res, row, 1, name.data(), name.size());
+	}
+
+	return(res);
+}
+
+void ResultSetTest::moveResultWithoutCopy(void)
+{
+	PGresult *pg_res=createResult(10);
+	TestResultSet src_res(pg_res), dst_res;
+
+	//The destination must take the ownership of the very same result leaving the source without any
+	dst_res=std::move(src_res);
+	QVERIFY(dst_res.getResult()==pg_res);
+	QVERIFY(src_res.getResult()==nullptr);
+	QCOMPARE(dst_res.getTupleCount(), 10);
+
+	TestResultSet moved_res(std::move(dst_res));
+	QVERIFY(moved_res.getResult()==pg_res);
+	QVERIFY(dst_res.getResult()==nullptr);
+
+	QVERIFY(moved_res.accessTuple(ResultSet::LAST_TUPLE));
+	QCOMPARE(QString(moved_res.getColumnValue(QString("name"))), QString("name_9"));
+}
+
+void ResultSetTest::columnDataReferencesResult(void)
+{
+	TestResultSet res(createResult(10));
+	QByteArray value;
+
+	QCOMPARE(res.getColumnNames(), QStringList({ QString("id"), QString("name") }));
+	QVERIFY(res.accessTuple(ResultSet::LAST_TUPLE));
+
+	value=res.getColumnData(1);
+	QCOMPARE(value, QByteArray("name_9"));
+	QVERIFY(value.constData()==PQgetvalue(res.getResult(), 9, 1));
+	QVERIFY_EXCEPTION_THROWN(res.getColumnData(2), Exception);
+}
+
+void ResultSetTest::benchmarkLargeResultCopy(void)
+{
+	PGresult *pg_res=createResult(TUPLE_COUNT), *copy_res=nullptr;
+
+	//Measures the tuple duplication formerly done when handing a result to the caller
+	QBENCHMARK
+	{
+		copy_res=PQcopyResult(pg_res, PG_COPYRES_TUPLES | PG_COPYRES_ATTRS | PG_COPYRES_EVENTS);
+		PQclear(copy_res);
+	}
+
+	PQclear(pg_res);
+}
+
+void ResultSetTest::benchmarkLargeResultMove(void)
+{
+	PGresult *pg_res=createResult(TUPLE_COUNT);
+	TestResultSet src_res(pg_res), dst_res;
+
+	//The result goes back and forth so each iteration starts from the same state
+	QBENCHMARK
+	{
+		dst_res=std::move(src_res);
+		src_res=std::move(dst_res);
+	}
+
+	QVERIFY(src_res.getResult()==pg_res);
+	QVERIFY(dst_res.getResult()==nullptr);
+	QCOMPARE(src_res.getTupleCount(), TUPLE_COUNT);
+}
+
+QTEST_MAIN(ResultSetTest)
+#include "resultsettest.moc"
@@ -0,0 +1,3 @@
+include(../../tests.pri)
+LIBS += $$PGSQL_LIB
+SOURCES += resultsettest.cpp
@@ -25,6 +25,7 @@ class SchemaParserTest: public QObject {
 
   private slots:
 		void testExpressionEvaluationWithCasts(void);
+		void testCachedFileReloadedWhenChanged(void);
 };
 
 void SchemaParserTest::testExpressionEvaluationWithCasts(void)
@@ -51,5 +52,39 @@ void SchemaParserTest::testExpressionEvaluationWithCasts(void)
 	}
 }
 
+void SchemaParserTest::testCachedFileReloadedWhenChanged(void)
+{
+	SchemaParser schparser;
+	QString filename=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DIR_SEPARATOR + QString("cachetest.sch");
+	QFile output(filename);
+	attribs_map attribs;
+
+	try
+	{
+		attribs["name"]="foo";
+
+		output.open(QFile::WriteOnly | QFile::Truncate);
+		output.write("[CREATE TABLE ] {name};");
+		output.close();
+
+		QCOMPARE(schparser.getCodeDefinition(filename, attribs), QString("CREATE TABLE foo;"));
+
+		//The second call is served by the cache
+		QCOMPARE(schparser.getCodeDefinition(filename, attribs), QString("CREATE TABLE foo;"));
+
+		output.open(QFile::WriteOnly | QFile::Truncate);
+		output.write("[DROP TABLE IF EXISTS ] {name};");
+		output.close();
+
+		QCOMPARE(schparser.getCodeDefinition(filename, attribs), QString("DROP TABLE IF EXISTS foo;"));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	QFile::remove(filename);
+}
+
 QTEST_MAIN(SchemaParserTest)
 #include "schemaparsertest.moc"
@@ -12,5 +12,9 @@ SUBDIRS = src/main \
 					src/roletest \
 					src/syntaxhighlightertest \
 					src/databasemodeltest \
-					src/schemaparsertest
+					src/schemaparsertest \
+					src/resultsettest \
+					src/csvreadertest \
+					src/pngwritertest \
+					src/relationshiproutertest
 